@@ -0,0 +1,242 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#define LS_TEST_PORT            16454       // kept off the standard Art-Net port, so real nodes on this machine are left alone
+#define LS_TEST_FRAME_RATE      200.
+#define LS_TEST_FRAMES          1000
+#define LS_TEST_PIXELS_PER_BAR  170         // one RGB8 universe per bar, 4 universes per frame
+
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <LumasonicArtNetListener.h>
+
+using namespace std;
+
+//==============================================================================
+// What the receiving side saw
+struct ReceiveResults
+{
+    int numFrames = 0;              // ArtSync packets closing a complete frame
+    int numUniverses = 0;           // ArtDmx packets
+    int orderErrors = 0;            // universes out of order, or a frame closed before all of its universes arrived
+    int sequenceErrors = 0;         // frames whose Art-Net sequence number does not follow the previous frame
+    int dataErrors = 0;             // DMX data that does not belong to the frame
+    double firstSyncMs = 0.;
+    double lastSyncMs = 0.;
+    double maxIntervalMs = 0.;
+};
+
+// Receives the ArtDmx and ArtSync packets on the loopback interface until asked to stop.
+void receive(LsUtils::UdpSocket& socket, int numUniverses, atomic<bool>& running, ReceiveResults& results);
+
+// The process handed to the listener; the test has no reader to stop.
+struct TestProcess : public LumasonicRunningProcess
+{
+    void signalProcessShouldExit() override {}
+};
+
+// 127.0.0.1 as a 4 byte unsigned int
+const unsigned int loopbackAddress = 0x7F000001u;
+
+//==============================================================================
+// Main Entry
+int main(/*int argc, char* argv[]*/)
+{
+    // Open the receiving socket first, so no packet is sent before anyone listens
+    LsUtils::UdpSocket receiver;
+
+    if (!receiver.open(loopbackAddress, LS_TEST_PORT, false) || !receiver.setReceiveTimeout(50))
+    {
+        cout << "Could not open the receiving socket on port " << LS_TEST_PORT << "." << endl;
+        return 1;
+    }
+
+    receiver.setReceiveBufferSize(1 << 20);
+
+    // Two pairs of bars, every universe sent to the loopback address and closed by an ArtSync
+    ArtNetListenerConfig cfg {};
+    cfg.localAddress = loopbackAddress;
+    cfg.remoteAddress = loopbackAddress;
+    cfg.remotePort = LS_TEST_PORT;
+    cfg.startUniverse = 0;
+    cfg.sync = true;
+
+    cfg.pixelMap.layout = LumasonicLedBarLayouts::LS_Layout_2x2;
+    cfg.pixelMap.pixelsPerBar = LS_TEST_PIXELS_PER_BAR;
+    cfg.pixelMap.encoding = LumasonicPixelEncodings::LS_Pixel_RGB8;
+
+    for (auto& output : cfg.pixelMap.outputs)
+        output = { true, 1.f, false };
+
+    LumasonicArtNetListener listener;
+
+    if (!listener.startArtNet(cfg))
+    {
+        cout << "Could not start the Art-Net listener." << endl;
+        return 1;
+    }
+
+    const int numUniverses = listener.getNumUniverses();
+
+    cout << endl << "Sending " << LS_TEST_FRAMES << " frames of " << numUniverses << " universes at "
+        << LS_TEST_FRAME_RATE << " fps to 127.0.0.1:" << LS_TEST_PORT << "..." << endl << endl;
+
+    atomic<bool> running { true };
+    ReceiveResults results;
+    thread receiving(receive, ref(receiver), numUniverses, ref(running), ref(results));
+
+    // Stand in for the reader's thread: one sample per frame, at a fixed rate. Each
+    // sample's level is the frame number, so the receiver can tell the frames apart.
+    TestProcess process;
+    auto frameTime = chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(1. / LS_TEST_FRAME_RATE));
+    auto nextFrame = chrono::steady_clock::now();
+
+    for (int i = 0; i < LS_TEST_FRAMES; ++i)
+    {
+        this_thread::sleep_until(nextFrame);
+        nextFrame += frameTime;
+
+        float level = (float)(i % 256) / 255.f;
+        listener.onStereoColorRead(process, StereoColorSample((unsigned long long)i, level, level, level, level, level, level));
+    }
+
+    // Give the last packets time to arrive
+    this_thread::sleep_for(chrono::milliseconds(200));
+    running.store(false);
+    receiving.join();
+    listener.stopArtNet();
+
+    double seconds = (results.lastSyncMs - results.firstSyncMs) / 1000.;
+    double frameRate = results.numFrames > 1 && seconds > 0. ? (results.numFrames - 1) / seconds : 0.;
+
+    cout << fixed << setprecision(2)
+        << "Frames received:    " << results.numFrames << " / " << listener.getNumFramesSent() << endl
+        << "Universes received: " << results.numUniverses << " / " << (long long)listener.getNumFramesSent() * numUniverses << endl
+        << "Frame rate:         " << frameRate << " fps (largest gap " << results.maxIntervalMs << " ms)" << endl
+        << "Order errors:       " << results.orderErrors << endl
+        << "Sequence errors:    " << results.sequenceErrors << endl
+        << "Data errors:        " << results.dataErrors << endl << endl;
+
+    // Sleep jitter on a busy machine is tolerated, as long as the average rate holds
+    bool passed = results.numFrames == LS_TEST_FRAMES
+               && results.orderErrors == 0 && results.sequenceErrors == 0 && results.dataErrors == 0
+               && frameRate > LS_TEST_FRAME_RATE * .95 && frameRate < LS_TEST_FRAME_RATE * 1.05;
+
+    cout << (passed ? "PASSED" : "FAILED") << endl << endl;
+    return passed ? 0 : 1;
+}
+
+//==============================================================================
+void receive(LsUtils::UdpSocket& socket, int numUniverses, atomic<bool>& running, ReceiveResults& results)
+{
+    static const unsigned char artNetId[8] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0 };
+    const int batchSize = 32;
+
+    vector<unsigned char> buffers((size_t)batchSize * LS_ARTNET_PACKET_SIZE);
+    LsUtils::UdpReceivedMessage messages[batchSize];
+
+    for (int i = 0; i < batchSize; ++i)
+        messages[i] = { buffers.data() + (size_t)i * LS_ARTNET_PACKET_SIZE, LS_ARTNET_PACKET_SIZE, 0, NetAddress(), 0 };
+
+    auto start = chrono::steady_clock::now();
+    int nextUniverse = 0;
+    int lastSequence = -1;
+    int lastLevel = -1;
+    int frameLevel = -1;
+
+    while (running.load())
+    {
+        int count = socket.receiveBatch(messages, batchSize);
+
+        if (count < 0)
+            break;
+
+        for (int m = 0; m < count; ++m)
+        {
+            const unsigned char* p = messages[m].data;
+
+            if (messages[m].size < LS_ARTNET_SYNC_SIZE || memcmp(p, artNetId, sizeof(artNetId)) != 0)
+                continue;
+
+            int opCode = p[8] | (p[9] << 8);
+
+            if (opCode == 0x5000 && messages[m].size > LS_ARTNET_HEADER_SIZE)
+            {
+                int sequence = p[12];
+                int universe = p[14] | (p[15] << 8);
+                int level = p[LS_ARTNET_HEADER_SIZE];       // the red channel of the universe's first pixel
+
+                results.numUniverses++;
+
+                if (universe != nextUniverse)
+                    results.orderErrors++;
+
+                if (universe == 0)
+                {
+                    // Sequence numbers run from 1 to 255, and the sample levels from 0 to 255
+                    if (lastSequence >= 0 && sequence != (lastSequence == 255 ? 1 : lastSequence + 1))
+                        results.sequenceErrors++;
+
+                    if (lastLevel >= 0 && level != (lastLevel + 1) % 256)
+                        results.dataErrors++;
+
+                    lastSequence = sequence;
+                    lastLevel = level;
+                    frameLevel = level;
+                }
+                else if (level != frameLevel || sequence != lastSequence)
+                {
+                    results.dataErrors++;
+                }
+
+                nextUniverse = universe + 1;
+            }
+            else if (opCode == 0x5200)
+            {
+                if (nextUniverse != numUniverses)
+                {
+                    results.orderErrors++;
+                }
+                else
+                {
+                    double nowMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+                    if (results.numFrames++ == 0)
+                        results.firstSyncMs = nowMs;
+                    else if (nowMs - results.lastSyncMs > results.maxIntervalMs)
+                        results.maxIntervalMs = nowMs - results.lastSyncMs;
+
+                    results.lastSyncMs = nowMs;
+                }
+
+                nextUniverse = 0;
+            }
+        }
+    }
+}
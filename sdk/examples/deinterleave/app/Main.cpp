@@ -0,0 +1,147 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#define LS_BENCH_SAMPLES        512
+#define LS_BENCH_CHANNELS       18
+#define LS_BENCH_FIRST_CHANNEL  8
+#define LS_BENCH_REPEATS        200000
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <LumasonicUtils.h>
+
+using namespace std;
+
+//==============================================================================
+// Runs a task many times and returns the average time of one run in microseconds.
+template <typename Task>
+double timeTask(Task task);
+
+// Prints one line of results with the speed-up of the SIMD version.
+void printResult(const char* name, double scalarUs, double simdUs);
+
+// Keeps the compiler from optimizing away the work being timed.
+volatile float sink = 0.f;
+
+//==============================================================================
+// Main Entry
+int main(/*int argc, char* argv[]*/)
+{
+    // Fill the interleaved test buffers with random audio
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+    const int numSamples = LS_BENCH_SAMPLES;
+    const int numChannels = LS_BENCH_CHANNELS;
+    const int firstChannel = LS_BENCH_FIRST_CHANNEL;
+
+    vector<float> stereo((size_t)numSamples * 2);
+    vector<float> multichannel((size_t)numSamples * numChannels);
+    vector<int16_t> multichannel16((size_t)numSamples * numChannels);
+    vector<float> left(numSamples), right(numSamples);
+
+    for (auto& s : stereo) s = dist(rng);
+    for (auto& s : multichannel) s = dist(rng);
+    for (auto& s : multichannel16) s = (int16_t)(rng() & 0xFFFF);
+
+    cout << endl << "De-interleaving " << numSamples << " samples per channel, average of "
+        << LS_BENCH_REPEATS << " runs..." << endl << endl;
+
+    // Stereo: the generic template against the float overload
+    double scalarUs = timeTask([&] {
+        LsUtils::deinterleaveStereoAudio<float>(stereo.data(), left.data(), right.data(), numSamples);
+        sink = sink + left[7];
+    });
+
+    double simdUs = timeTask([&] {
+        LsUtils::deinterleaveStereoAudio(stereo.data(), left.data(), right.data(), numSamples);
+        sink = sink + left[7];
+    });
+
+    printResult("Stereo", scalarUs, simdUs);
+
+    // One pair of an 18 channel interface: a plain loop against deinterleaveChannelPair()
+    scalarUs = timeTask([&] {
+        for (int s = 0; s < numSamples; ++s)
+        {
+            left[s] = multichannel[(size_t)s * numChannels + firstChannel];
+            right[s] = multichannel[(size_t)s * numChannels + firstChannel + 1];
+        }
+        sink = sink + left[7];
+    });
+
+    simdUs = timeTask([&] {
+        LsUtils::deinterleaveChannelPair(multichannel.data(), numChannels, firstChannel, left.data(), right.data(), numSamples);
+        sink = sink + left[7];
+    });
+
+    printResult("18 channel pair", scalarUs, simdUs);
+
+    // The same pair from 16-bit PCM, converted to float on the way
+    scalarUs = timeTask([&] {
+        for (int s = 0; s < numSamples; ++s)
+        {
+            left[s] = multichannel16[(size_t)s * numChannels + firstChannel] * (1.f / 32768.f);
+            right[s] = multichannel16[(size_t)s * numChannels + firstChannel + 1] * (1.f / 32768.f);
+        }
+        sink = sink + left[7];
+    });
+
+    simdUs = timeTask([&] {
+        LsUtils::deinterleaveChannelPairInt16(multichannel16.data(), numChannels, firstChannel, left.data(), right.data(), numSamples);
+        sink = sink + left[7];
+    });
+
+    printResult("18 channel int16 pair", scalarUs, simdUs);
+
+    cout << endl;
+    return 0;
+}
+
+//==============================================================================
+template <typename Task>
+double timeTask(Task task)
+{
+    // Warm up the caches first
+    for (int i = 0; i < LS_BENCH_REPEATS / 100; ++i)
+        task();
+
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < LS_BENCH_REPEATS; ++i)
+        task();
+
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / LS_BENCH_REPEATS;
+}
+
+void printResult(const char* name, double scalarUs, double simdUs)
+{
+    cout << fixed << setprecision(3) << left << setw(24) << name
+        << "scalar: " << scalarUs << " us, simd: " << simdUs << " us ("
+        << setprecision(2) << scalarUs / simdUs << "x)" << endl;
+}
@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#define LS_BENCH_BARS           4
+#define LS_BENCH_PIXELS_PER_BAR 300
+#define LS_BENCH_FRAME_RATE     200.
+#define LS_BENCH_FRAMES         20000
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <LumasonicPixelEffects.h>
+
+using namespace std;
+
+//==============================================================================
+// Renders frames of an effect through the engine and the mapper, and returns the
+// average time of one frame in microseconds.
+double timeEffect(LumasonicPixelEffects effect, float frameDecay, const vector<StereoColorSample>& samples);
+
+// Prints one line of results with the share of the frame budget used.
+void printResult(const char* name, float frameDecay, double frameUs);
+
+// Keeps the compiler from optimizing away the work being timed.
+volatile unsigned char sink = 0;
+
+//==============================================================================
+// Main Entry
+int main(/*int argc, char* argv[]*/)
+{
+    // A fixed sequence of random samples, shared by every effect
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+
+    vector<StereoColorSample> samples(1024);
+    unsigned long long ts = 0;
+
+    for (auto& s : samples)
+        s = StereoColorSample(ts++, dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng));
+
+    cout << endl << "Rendering " << LS_BENCH_BARS << " bars x " << LS_BENCH_PIXELS_PER_BAR << " RGB8 pixels at "
+        << LS_BENCH_FRAME_RATE << " fps, average of " << LS_BENCH_FRAMES << " frames..." << endl << endl;
+
+    const struct { const char* name; LumasonicPixelEffects effect; } effects[] =
+    {
+        { "Stereo Color",   LumasonicPixelEffects::LS_Effect_Stereo_Color },
+        { "Forward Fill",   LumasonicPixelEffects::LS_Effect_Forward_Fill },
+        { "Backward Fill",  LumasonicPixelEffects::LS_Effect_Backward_Fill },
+        { "Ping Pong Fill", LumasonicPixelEffects::LS_Effect_Ping_Pong_Fill }
+    };
+
+    for (auto& e : effects)
+    {
+        printResult(e.name, 0.f, timeEffect(e.effect, 0.f, samples));
+        printResult(e.name, .25f, timeEffect(e.effect, .25f, samples));
+    }
+
+    cout << endl;
+    return 0;
+}
+
+//==============================================================================
+double timeEffect(LumasonicPixelEffects effect, float frameDecay, const vector<StereoColorSample>& samples)
+{
+    PixelMapConfig pixelMap {};
+    pixelMap.layout = LumasonicLedBarLayouts::LS_Layout_4x1;
+    pixelMap.pixelsPerBar = LS_BENCH_PIXELS_PER_BAR;
+    pixelMap.encoding = LumasonicPixelEncodings::LS_Pixel_RGB8;
+    pixelMap.effect = effect;
+    pixelMap.frameDecay = frameDecay;
+
+    for (auto& output : pixelMap.outputs)
+        output = { true, 1.f, false };
+
+    LsUtils::PixelMapper mapper;
+    LsUtils::PixelEffectEngine engine;
+
+    mapper.configure(pixelMap);
+    engine.configure(mapper.getConfig());
+
+    // The universe buffers a listener would send, preallocated like its packets
+    vector<unsigned char> universes((size_t)mapper.getNumUniverses() * LS_DMX_UNIVERSE_SIZE);
+    const double elapsedSeconds = 1. / LS_BENCH_FRAME_RATE;
+
+    auto renderFrame = [&](int frame)
+    {
+        engine.process(samples[(size_t)frame % samples.size()], elapsedSeconds);
+        mapper.render(engine.getFrame(), universes.data(), LS_DMX_UNIVERSE_SIZE);
+        sink = sink + universes[(size_t)frame % universes.size()];
+    };
+
+    // Warm up the caches and fill the bars first
+    for (int i = 0; i < LS_BENCH_FRAMES / 100; ++i)
+        renderFrame(i);
+
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < LS_BENCH_FRAMES; ++i)
+        renderFrame(i);
+
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / LS_BENCH_FRAMES;
+}
+
+void printResult(const char* name, float frameDecay, double frameUs)
+{
+    const double budgetUs = 1000000. / LS_BENCH_FRAME_RATE;
+
+    cout << fixed << setprecision(3) << left << setw(16) << name
+        << "decay: " << setprecision(2) << frameDecay << " s, "
+        << setprecision(3) << frameUs << " us per frame ("
+        << setprecision(2) << frameUs / budgetUs * 100. << "% of the frame budget)" << endl;
+}
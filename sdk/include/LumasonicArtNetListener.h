@@ -0,0 +1,209 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPixelListener.h"
+#include <cstring>
+#include <mutex>
+
+// The number of bytes of an ArtDmx packet before the DMX data
+#define LS_ARTNET_HEADER_SIZE       18
+
+// The number of bytes of an ArtDmx packet carrying a full universe
+#define LS_ARTNET_PACKET_SIZE       (LS_ARTNET_HEADER_SIZE + LS_DMX_UNIVERSE_SIZE)
+
+// The number of bytes of an ArtSync packet
+#define LS_ARTNET_SYNC_SIZE         14
+
+//==============================================================================
+/**
+ * @brief Listener class that drives LED pixel bars over Art-Net from decoded
+ * @ref StereoColorSample values.
+ *
+ * @details
+ * Works like @ref LumasonicSacnListener and shares its pixel mapping (see
+ * @ref PixelMapConfig): each sample is rendered into one ArtDmx packet per
+ * universe, and all universes of the frame are sent in one batched burst.
+ *
+ * With @ref ArtNetListenerConfig::sync enabled, an ArtSync packet closes each
+ * burst. Nodes that support it hold the new DMX data until the ArtSync arrives
+ * and then update every output at once, so bars on different universes never
+ * show parts of two frames.
+ *
+ * > [!NOTE]
+ * > Values are sent on the reader's thread. The listener will not send anything
+ * > until you start it using @ref startArtNet(const ArtNetListenerConfig&).
+ *
+ * ### Configuring the Listener
+ *
+ * ```c++
+ *
+ * auto* artNetListener = new LumasonicArtNetListener();
+ *
+ * ArtNetListenerConfig cfg {};
+ * cfg.localAddress = LumasonicStereoUdpListener::ipv4AddressFromStr("2.0.0.10");
+ * cfg.remoteAddress = LumasonicStereoUdpListener::ipv4AddressFromStr("2.255.255.255");  // Art-Net directed broadcast
+ * cfg.startUniverse = 0;
+ * cfg.sync = true;
+ *
+ * cfg.pixelMap.layout = LumasonicLedBarLayouts::LS_Layout_2x2;
+ * cfg.pixelMap.pixelsPerBar = 170;
+ * cfg.pixelMap.encoding = LumasonicPixelEncodings::LS_Pixel_RGB8;
+ *
+ * for (auto& output : cfg.pixelMap.outputs)
+ *     output = { true, 1.f, false };
+ *
+ * artNetListener->startArtNet(cfg);
+ * lsReader->addListener(artNetListener);
+ *
+ * ```
+ *
+ * The output, universe and packet counter methods are inherited from @ref LumasonicPixelListener.
+ */
+class LumasonicArtNetListener : public LumasonicPixelListener
+{
+public:
+    //==============================================================================
+    /** @brief Constructor*/
+    LumasonicArtNetListener()
+        : LumasonicPixelListener(LS_ARTNET_HEADER_SIZE, LS_ARTNET_PACKET_SIZE)
+    {
+        writeArtNetHeader(syncPacket, 0x5200);
+    }
+
+    /** @brief Destructor. Stops the stream if it is running.*/
+    ~LumasonicArtNetListener() override { stopArtNet(); }
+
+    //==============================================================================
+    /** @brief Configures the network and pixel settings and opens the socket. Any running stream is stopped first.
+        @param config               The Art-Net configuration to use for sending.
+        @return                     True if starting Art-Net succeeded, False if it failed.
+    */
+    bool startArtNet(const ArtNetListenerConfig& config)
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        streaming = false;
+        socket.close();
+
+        configureStream(config.pixelMap, config.startUniverse, 0, 0x7FFF, config.frameRateLimit);
+
+        remoteAddress = config.remoteAddress != 0 ? config.remoteAddress : 0xFFFFFFFFu;
+        remotePort = config.remotePort != 0 ? config.remotePort : (unsigned short)LS_ARTNET_PORT;
+        sync = config.sync;
+
+        for (int u = 0; u < mapper.getNumUniverses(); ++u)
+            buildPacket(u);
+
+        if (!socket.open(config.localAddress, 0, false) || !socket.setBroadcast(true))
+        {
+            socket.close();
+            return false;
+        }
+
+        streaming = true;
+        return true;
+    }
+
+    /** @brief Stops sending and releases the socket.*/
+    void stopArtNet()
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        streaming = false;
+        socket.close();
+    }
+
+    /** @brief Whether an ArtSync packet is sent after each frame.*/
+    bool isSyncEnabled() const
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        return sync;
+    }
+
+protected:
+    //==============================================================================
+    void sendFrame() override
+    {
+        int numUniverses = mapper.getNumUniverses();
+
+        // Art-Net sequence numbers run from 1 to 255; 0 disables resequencing on the node
+        sequence = sequence == 255 ? 1 : sequence + 1;
+
+        for (int u = 0; u < numUniverses; ++u)
+        {
+            packet(u)[12] = sequence;
+            messages[u] = { packet(u), packetSizes[u], remoteAddress, remotePort };
+        }
+
+        int numMessages = numUniverses;
+
+        if (sync)
+            messages[numMessages++] = { syncPacket, LS_ARTNET_SYNC_SIZE, remoteAddress, remotePort };
+
+        sendPackets(messages, numMessages);
+    }
+
+private:
+    //==============================================================================
+    static void writeArtNetHeader(unsigned char* p, unsigned short opCode)
+    {
+        static const unsigned char id[8] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0 };
+
+        std::memcpy(p, id, sizeof(id));
+        p[8] = (unsigned char)opCode;               // OpCode is little-endian
+        p[9] = (unsigned char)(opCode >> 8);
+        writeBE16(p + 10, 14);                      // protocol version
+    }
+
+    // Fills in the parts of a universe's packet that don't change from frame to frame
+    void buildPacket(int universeIndex)
+    {
+        auto* p = packet(universeIndex);
+        int universe = startUniverse + universeIndex;
+
+        // The DMX data length must be even
+        int length = mapper.getNumChannels(universeIndex);
+        length += length & 1;
+        packetSizes[universeIndex] = (size_t)(LS_ARTNET_HEADER_SIZE + length);
+
+        writeArtNetHeader(p, 0x5000);
+        p[13] = 0;                                  // physical input port
+        p[14] = (unsigned char)(universe & 0xFF);   // sub-net and universe
+        p[15] = (unsigned char)(universe >> 8);     // net
+        writeBE16(p + 16, (unsigned short)length);
+    }
+
+    //==============================================================================
+    unsigned int remoteAddress = 0xFFFFFFFFu;
+    unsigned short remotePort = LS_ARTNET_PORT;
+    bool sync = false;
+    unsigned char sequence = 0;
+
+    size_t packetSizes[LS_PIXEL_MAX_UNIVERSES] {};
+    unsigned char syncPacket[LS_ARTNET_SYNC_SIZE] {};
+    LsUtils::UdpMessage messages[LS_PIXEL_MAX_UNIVERSES + 1];
+};
@@ -0,0 +1,217 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPerfStats.h"
+#include <atomic>
+#include <mutex>
+
+// The maximum number of samples a callback listener passes to its callback in one call
+#ifndef LS_CALLBACK_MAX_BATCH
+#define LS_CALLBACK_MAX_BATCH       64
+#endif
+
+//==============================================================================
+/**
+ * @brief Listener class that passes decoded @ref StereoColorSample values to a
+ * plain function pointer, one sample or one batch of samples at a time.
+ *
+ * @details
+ * Samples are pushed to the host on the reader's thread instead of being polled
+ * with @ref LumasonicStereoDecoder::popColorSample() once per sample. A plain
+ * function with a user data pointer is also the easiest kind of callback to
+ * bridge to hosts written in other languages.
+ *
+ * The callback takes no C++ types: @ref StereoColorSample has the same 32 byte
+ * layout as the `stereo_color_sample` struct of the C API.
+ *
+ * With a maximum batch size above 1, samples are held until the batch is full or
+ * holding them any longer would exceed the maximum latency, then passed in a
+ * single call. Like @ref LumasonicStereoUdpBatchListener, the latency bound is
+ * kept by predicting when the next sample will arrive, so no extra thread is needed.
+ *
+ * > [!NOTE]
+ * > The callback runs on the reader's thread and holds up every listener after it,
+ * > so it should return quickly. It may call @ref flush() but must not delete the listener.
+ *
+ * > [!NOTE]
+ * > The callback listener is only available to C++ hosts. The prebuilt decoder library
+ * > exports no function that creates one or registers it with a reader created through
+ * > the C API, so hosts loading the library through a foreign function interface
+ * > should keep polling with `ls_decoder_pop_color_sample()`.
+ *
+ * ### Receiving Samples
+ *
+ * ```c++
+ *
+ * void onSamples(const StereoColorSample* samples, int numSamples, void* userData)
+ * {
+ *     auto* meter = static_cast<Meter*>(userData);
+ *     meter->update(samples[numSamples - 1]);
+ * }
+ *
+ * auto* callbackListener = new LumasonicCallbackListener(onSamples, &meter, 8, 10.);  // batches of up to 8 samples, held at most 10 ms
+ * lsReader->addListener(callbackListener);
+ *
+ * ```
+ */
+class LumasonicCallbackListener : public LumasonicStereoColorListener
+{
+public:
+    //==============================================================================
+    /** @brief Constructor
+        @param sampleCallback       The function to pass samples to, or nullptr to drop them.
+        @param callbackUserData     A pointer passed back to the callback unchanged.
+        @param maxBatchSamples      The maximum number of samples per call. Use 1 to call the callback once per sample.
+        @param maxLatencyMs         The maximum time in milliseconds a sample is held before it is passed on.
+    */
+    explicit LumasonicCallbackListener(LumasonicSampleCallback sampleCallback, void* callbackUserData = nullptr,
+                                       int maxBatchSamples = 1, double maxLatencyMs = 0.)
+        : callback(sampleCallback), userData(callbackUserData)
+    {
+        setMaxBatchSize(maxBatchSamples);
+        setMaxLatency(maxLatencyMs);
+    }
+
+    /** @brief Destructor. Passes on any held samples.*/
+    ~LumasonicCallbackListener() override { flush(); }
+
+    //==============================================================================
+    /** @brief The unique ID of the instance.*/
+    int id = -1;
+
+    /** @brief Passes any held samples to the callback right away.*/
+    void flush()
+    {
+        std::lock_guard<std::recursive_mutex> sl(lock);
+        deliverPending();
+    }
+
+    /** @brief Gets the maximum number of samples per call. This method is thread-safe/atomic.*/
+    int getMaxBatchSize() const { return maxBatch.load(); }
+
+    /** @brief Sets the maximum number of samples per call, from 1 to @ref LS_CALLBACK_MAX_BATCH. This method is thread-safe/atomic.*/
+    void setMaxBatchSize(int maxBatchSamples)
+    {
+        maxBatch.store(maxBatchSamples < 1 ? 1 : (maxBatchSamples > LS_CALLBACK_MAX_BATCH ? LS_CALLBACK_MAX_BATCH : maxBatchSamples));
+    }
+
+    /** @brief Gets the maximum time in milliseconds a sample is held before it is passed on. This method is thread-safe/atomic.*/
+    double getMaxLatency() const { return maxLatencyNanos.load() / 1e6; }
+
+    /** @brief Sets the maximum time in milliseconds a sample is held before it is passed on. This method is thread-safe/atomic.*/
+    void setMaxLatency(double maxLatencyMs) { maxLatencyNanos.store(maxLatencyMs > 0. ? (unsigned long long)(maxLatencyMs * 1e6) : 0); }
+
+    /** @brief Gets the total number of callback calls made.*/
+    unsigned long long getNumCalls() const { return numCalls.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the total number of samples passed to the callback.*/
+    unsigned long long getNumSamples() const { return numSamples.load(std::memory_order_relaxed); }
+
+    /** @brief Resets the number of calls and samples to 0.*/
+    void resetCounters()
+    {
+        numCalls.store(0, std::memory_order_relaxed);
+        numSamples.store(0, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    /** @brief This method is called when the reader's thread has new color data available.
+        @param process              A reference to the running process that called this listener.
+        @param stereoColor          The stereo color sample value that has been read.
+    */
+    void onStereoColorRead(LumasonicRunningProcess& /*process*/, StereoColorSample stereoColor) override
+    {
+        std::lock_guard<std::recursive_mutex> sl(lock);
+
+        int limit = maxBatch.load();
+
+        // Unbatched calls skip the clock entirely
+        if (limit == 1)
+        {
+            pending[numPending++] = stereoColor;
+            deliverPending();
+            return;
+        }
+
+        auto now = LsUtils::monotonicNanos();
+
+        // Same conservative estimate of the gap to the next sample as the UDP batch listener
+        if (lastArrivalNanos != 0)
+        {
+            auto gap = now - lastArrivalNanos;
+            expectedGapNanos = gap > expectedGapNanos ? gap : expectedGapNanos - (expectedGapNanos - gap) / 8;
+        }
+
+        lastArrivalNanos = now;
+
+        if (numPending == 0)
+            firstPendingNanos = now;
+
+        pending[numPending++] = stereoColor;
+
+        bool full = numPending >= limit;
+        bool late = (now - firstPendingNanos) + expectedGapNanos >= maxLatencyNanos.load();
+
+        if (full || late)
+            deliverPending();
+    }
+
+private:
+    //==============================================================================
+    // Must be called with the lock held. The count is cleared before the call, so
+    // a flush from inside the callback finds nothing to deliver.
+    void deliverPending()
+    {
+        int count = numPending;
+        numPending = 0;
+
+        if (count == 0 || callback == nullptr)
+            return;
+
+        callback(pending, count, userData);
+
+        numCalls.fetch_add(1, std::memory_order_relaxed);
+        numSamples.fetch_add((unsigned long long)count, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    const LumasonicSampleCallback callback;
+    void* const userData;
+
+    std::recursive_mutex lock;
+    std::atomic<int> maxBatch { 1 };
+    std::atomic<unsigned long long> maxLatencyNanos { 0 };
+
+    StereoColorSample pending[LS_CALLBACK_MAX_BATCH];
+    int numPending = 0;
+    unsigned long long firstPendingNanos = 0;
+    unsigned long long lastArrivalNanos = 0;
+    unsigned long long expectedGapNanos = 0;
+
+    std::atomic<unsigned long long> numCalls { 0 };
+    std::atomic<unsigned long long> numSamples { 0 };
+};
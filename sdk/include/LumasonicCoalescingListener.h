@@ -0,0 +1,280 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPerfStats.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+//==============================================================================
+/**
+    @brief Different ways a @ref LumasonicCoalescingListener combines the samples received during one frame.
+*/
+enum class LumasonicCoalesceModes
+{
+    LS_Coalesce_Latest = 0,     ///< Deliver the newest sample of the frame
+    LS_Coalesce_Max,            ///< Deliver the per-channel maximum of the frame's samples
+    LS_Coalesce_Mean            ///< Deliver the per-channel mean of the frame's samples
+};
+
+//==============================================================================
+/**
+ * @brief A listener that coalesces the @ref StereoColorSample values it receives
+ * from a reader and passes one sample per frame to a slower listener, on its own
+ * thread and at its own rate.
+ *
+ * @details
+ * Readers dispatch every decoded sample (around **187 Hz** at 48 KHz / 256 samples).
+ * Display listeners that render at **60 - 120 Hz** only need the newest color, so
+ * handing them every sample wastes work and holds up the reader's thread.
+ *
+ * The coalescing listener is registered with a reader in place of the slow
+ * listener. On the reader's thread it only folds the new sample into the current
+ * frame and publishes it through a sequence lock. Its own thread wakes at the
+ * requested frame rate and calls the wrapped listener once per frame, but only
+ * if a new sample arrived during that frame.
+ *
+ * ### Wrapping a Listener
+ *
+ * ```c++
+ *
+ * VisualsUpdater visuals;                                  // a slow listener class
+ * LumasonicCoalescingListener coalescer(&visuals, 60.);    // deliver at most 60 samples per second
+ * coalescer.setMode(LumasonicCoalesceModes::LS_Coalesce_Max);
+ *
+ * lsReader->addListener(&coalescer);                       // register the coalescer instead of the slow listener
+ * coalescer.start();                                       // start the delivery thread
+ *
+ * ```
+ *
+ * The @ref LumasonicRunningProcess passed to the wrapped listener is the coalescing
+ * listener itself: calling `signalProcessShouldExit()` stops the delivery thread,
+ * not the reader.
+ *
+ * The coalescing listener can be registered with more than one reader, or with a
+ * multi-reader using several threads; samples arriving from different threads are
+ * folded into the frame one at a time.
+ *
+ * ### Stopping
+ *
+ * ```c++
+ *
+ * lsReader->removeListener(&coalescer);
+ * coalescer.stop();
+ *
+ * ```
+ */
+class LumasonicCoalescingListener : public LumasonicStereoColorListener, public LumasonicRunningProcess
+{
+public:
+    //==============================================================================
+    /** @brief Constructor
+        @param listener             The listener to deliver coalesced samples to.
+        @param frameRateHz          The rate at which the listener is woken, in frames per second.
+        @param coalesceMode         How the samples received during a frame are combined.
+    */
+    explicit LumasonicCoalescingListener(LumasonicStereoColorListener* listener, double frameRateHz = 60.,
+                                         LumasonicCoalesceModes coalesceMode = LumasonicCoalesceModes::LS_Coalesce_Latest)
+        : target(listener), mode(coalesceMode)
+    {
+        setFrameRate(frameRateHz);
+    }
+
+    /** @brief Destructor.*/
+    ~LumasonicCoalescingListener() override { stop(); }
+
+    //==============================================================================
+    /** @brief Gets the frame rate of the delivery thread in frames per second. This method is thread-safe/atomic.*/
+    double getFrameRate() const { return frameRate.load(); }
+
+    /** @brief Sets the frame rate of the delivery thread in frames per second. This method is thread-safe/atomic.*/
+    void setFrameRate(double newFrameRateHz) { frameRate.store(newFrameRateHz > 0. ? newFrameRateHz : 60.); }
+
+    /** @brief Gets how samples received during a frame are combined. This method is thread-safe/atomic.*/
+    LumasonicCoalesceModes getMode() const { return mode.load(); }
+
+    /** @brief Sets how samples received during a frame are combined. This method is thread-safe/atomic.*/
+    void setMode(LumasonicCoalesceModes newMode) { mode.store(newMode); }
+
+    /** @brief Starts the delivery thread.*/
+    void start()
+    {
+        if (running.load())
+            return;
+
+        if (thread.joinable())
+            thread.join();
+
+        running.store(true);
+        thread = std::thread(&LumasonicCoalescingListener::run, this);
+    }
+
+    /** @brief Stops the delivery thread.*/
+    void stop()
+    {
+        running.store(false);
+
+        if (thread.joinable() && thread.get_id() != std::this_thread::get_id())
+            thread.join();
+    }
+
+    /** @brief Whether the delivery thread is currently running. This method is thread-safe.*/
+    bool isRunning() const { return running.load(); }
+
+    /** @brief Called by the wrapped listener to stop the delivery thread.*/
+    void signalProcessShouldExit() override { running.store(false); }
+
+    /** @brief Gets the total number of samples received from the reader.*/
+    unsigned long long getNumSamplesReceived() const { return numReceived.load(); }
+
+    /** @brief Gets the total number of coalesced samples delivered to the wrapped listener.*/
+    unsigned long long getNumSamplesDelivered() const { return numDelivered.load(); }
+
+    //==============================================================================
+    /** @brief Folds a new sample into the current frame. Called on the reader's thread.
+        @param process              A reference to the running process that called this listener.
+        @param stereoColor          The stereo color sample value that has been read.
+    */
+    void onStereoColorRead(LumasonicRunningProcess& /*process*/, StereoColorSample stereoColor) override
+    {
+        // Only writers contend for the lock; the delivery thread never takes it
+        std::lock_guard<std::mutex> lock(foldLock);
+
+        // The delivery thread moves on to a new frame by advancing the frame ID. Raising the
+        // writing flag first (both sequentially consistent) means that either this load sees the
+        // new ID, or the delivery thread sees the flag and waits for the frame to be published.
+        writing.store(true, std::memory_order_seq_cst);
+        auto id = frameId.load(std::memory_order_seq_cst);
+
+        if (id != current.id || current.count == 0)
+        {
+            current.id = id;
+            current.count = 0;
+            current.peak = stereoColor;
+
+            for (auto& s : current.sum)
+                s = 0.;
+        }
+
+        const float values[6] = { stereoColor.r0, stereoColor.g0, stereoColor.b0, stereoColor.r1, stereoColor.g1, stereoColor.b1 };
+        float* peaks[6] = { &current.peak.r0, &current.peak.g0, &current.peak.b0, &current.peak.r1, &current.peak.g1, &current.peak.b1 };
+
+        for (int c = 0; c < 6; ++c)
+        {
+            current.sum[c] += values[c];
+            *peaks[c] = values[c] > *peaks[c] ? values[c] : *peaks[c];
+        }
+
+        current.latest = stereoColor;
+        ++current.count;
+
+        frames[id & 1].store(current);
+        writing.store(false, std::memory_order_release);
+        numReceived.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    //==============================================================================
+    // The samples received during one frame
+    struct Frame
+    {
+        StereoColorSample latest;
+        StereoColorSample peak;
+        double sum[6];
+        unsigned int count;
+        unsigned int id;
+    };
+
+    void run()
+    {
+        auto nextWake = std::chrono::steady_clock::now();
+
+        while (running.load())
+        {
+            nextWake += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1. / frameRate.load()));
+            std::this_thread::sleep_until(nextWake);
+
+            // Don't try to catch up on missed frames after a stall
+            auto now = std::chrono::steady_clock::now();
+            if (now > nextWake)
+                nextWake = now;
+
+            // Close the current frame; samples from now on go to the other buffer
+            auto id = frameId.fetch_add(1, std::memory_order_seq_cst);
+
+            // A sample that loaded the old ID just before the increment is still going into the
+            // closed frame; wait the few hundred nanoseconds it takes to be published
+            while (writing.load(std::memory_order_seq_cst))
+                std::this_thread::yield();
+
+            Frame frame;
+            if (!frames[id & 1].load(frame) || frame.id != id || frame.count == 0)
+                continue;
+
+            target->onStereoColorRead(*this, coalesce(frame));
+            numDelivered.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    StereoColorSample coalesce(const Frame& frame) const
+    {
+        switch (mode.load())
+        {
+            case LumasonicCoalesceModes::LS_Coalesce_Max:
+            {
+                auto sc = frame.peak;
+                sc.ts = frame.latest.ts;
+                return sc;
+            }
+            case LumasonicCoalesceModes::LS_Coalesce_Mean:
+            {
+                auto n = (double)frame.count;
+                return StereoColorSample(frame.latest.ts,
+                                         (float)(frame.sum[0] / n), (float)(frame.sum[1] / n), (float)(frame.sum[2] / n),
+                                         (float)(frame.sum[3] / n), (float)(frame.sum[4] / n), (float)(frame.sum[5] / n));
+            }
+            case LumasonicCoalesceModes::LS_Coalesce_Latest:
+            default:
+                return frame.latest;
+        }
+    }
+
+    //==============================================================================
+    LumasonicStereoColorListener* target;
+    std::atomic<double> frameRate { 60. };
+    std::atomic<LumasonicCoalesceModes> mode;
+    std::atomic<bool> running { false };
+    std::atomic<unsigned int> frameId { 0 };
+    std::atomic<bool> writing { false };        // set while the reader's thread folds a sample into a frame
+    std::atomic<unsigned long long> numReceived { 0 };
+    std::atomic<unsigned long long> numDelivered { 0 };
+    std::mutex foldLock;                        // serializes samples arriving from several reader threads
+    Frame current {};                           // guarded by the fold lock
+    LsUtils::SeqLock<Frame> frames[2];          // published frames, indexed by frame ID parity
+    std::thread thread;
+};
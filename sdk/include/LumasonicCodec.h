@@ -25,6 +25,7 @@
 #pragma once
 
 #include "LumasonicCommon.h"
+#include "LumasonicUtils.h"
 
 //==============================================================================
 /**
@@ -80,6 +81,20 @@ public:
     */
     static bool deinterleave_audio(const float* input, float* out0, float* out1, int samplesPerChannel);
 
+    /** @brief De-interleaves one pair of adjacent channels from an interleaved buffer with any number of channels, such as one stereo pair of a multi-channel audio interface.
+        @param input                The interleaved audio samples, numChannels samples per frame.
+        @param numChannels          The number of interleaved channels in the input (at least 2).
+        @param firstChannel         The index of the first channel of the pair, from 0 to numChannels - 2.
+        @param out0                 The pointer to the buffer that will contain the samples of channel firstChannel.
+        @param out1                 The pointer to the buffer that will contain the samples of channel firstChannel + 1.
+        @param samplesPerChannel    The number of frames (samples per channel) to de-interleave.
+        @return                     True if the process was successful, False it not.
+    */
+    static bool deinterleave_audio_pair(const float* input, int numChannels, int firstChannel, float* out0, float* out1, int samplesPerChannel)
+    {
+        return LsUtils::deinterleaveChannelPair(input, numChannels, firstChannel, out0, out1, samplesPerChannel);
+    }
+
     /** @brief Resets the static Lumasonic encoder to the given sample rate.
         @param sampleRate           The sample rate to reset the encoder to.
     */
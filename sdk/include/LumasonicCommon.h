@@ -62,6 +62,31 @@
 // Define the buffer size for strings for the network interface
 #define LS_NET_INTERFACE_NAME_SIZE  64
 
+// Define the buffer size for strings for an IPv4 or IPv6 address, including a "%scope" suffix
+#define LS_NET_ADDRESS_STR_SIZE     64
+
+// Define the maximum number of remote endpoints a UDP listener can fan out to
+#ifndef LS_UDP_MAX_DESTINATIONS
+#define LS_UDP_MAX_DESTINATIONS     16
+#endif
+
+// Define the number of pixel outputs (LED bars) of a lighting controller
+#define LS_PIXEL_NUM_OUTPUTS        4
+
+// Define the maximum number of DMX universes a pixel listener can drive
+#ifndef LS_PIXEL_MAX_UNIVERSES
+#define LS_PIXEL_MAX_UNIVERSES      32
+#endif
+
+// Define the buffer size for the sACN source name (including the null terminator)
+#define LS_SACN_SOURCE_NAME_SIZE    64
+
+// The standard sACN (E1.31) UDP port
+#define LS_SACN_PORT                5568
+
+// The standard Art-Net UDP port
+#define LS_ARTNET_PORT              6454
+
 //==============================================================================
 /**
     @brief Different light/sound codecs.
@@ -255,6 +280,18 @@ enum class LumasonicThreadModes
  * 
  * ```
  * 
+ * A @ref LumasonicStereoMultiReader also publishes the latest values with a sequence lock. Monitoring threads can poll them
+ * with `LumasonicStereoMultiReader::getPerfSnapshot(LumasonicReadPerfInfo&)`, which never blocks or contends with the reading threads.
+ * 
+ * ```c++
+ * 
+ * LumasonicReadPerfInfo info {};
+ *
+ * if (lsMultiReader->getPerfSnapshot(info))
+ *		auto avgDataTimeMs = info.dataAverageTimeMs;
+ * 
+ * ```
+ * 
  * ### Interpreting Performance Data
  * 
  * To calculate your target Lumasonic frames per second for the audio thread:
@@ -402,6 +439,13 @@ public:
 	virtual void onStereoColorRead(LumasonicRunningProcess& process, StereoColorSample stereoColor) = 0;
 };
 
+/** @brief A plain function that receives decoded samples from a @ref LumasonicCallbackListener.
+	@param samples				The samples, oldest first. The array is only valid during the call.
+	@param numSamples			The number of samples in the array, from 1 to the listener's maximum batch size.
+	@param userData				The pointer given when the listener was created.
+*/
+typedef void (*LumasonicSampleCallback)(const StereoColorSample* samples, int numSamples, void* userData);
+
 //==============================================================================
 /**
 	@brief Contains network/socket configuration settings for the @ref LumasonicStereoUdpListener class.
@@ -413,4 +457,278 @@ struct UdpListenerConfig
 	unsigned short remotePort;      ///< The remote port number to send to.
 	unsigned short localPort;       ///< The local port number to bind to. Use 0 to automatically select an open local port.
 	bool exclusive;                 ///< Whether the socket will bind in exclusive mode or share socket with other processes.
-};
\ No newline at end of file
+};
+
+//==============================================================================
+/**
+	@brief The address families of a @ref NetAddress.
+*/
+enum class LumasonicAddressFamilies
+{
+	LS_Address_None = 0,		///< No address
+	LS_Address_IPv4,			///< An IPv4 address
+	LS_Address_IPv6				///< An IPv6 address, with a scope ID for link-local addresses
+};
+
+//==============================================================================
+/**
+	@brief An IPv4 or IPv6 address.
+
+	@details
+	The bytes are stored in network order: 4 bytes for IPv4 and 16 bytes for IPv6.
+	Link-local IPv6 addresses (fe80::/10) need the scope ID, the index of the network
+	interface they belong to, which is the `%eth0` or `%12` suffix of their string form.
+
+	A 4 byte unsigned int IPv4 address (such as @ref LS_LOOPBACK_IPV4) converts to a
+	NetAddress implicitly, so existing IPv4 code keeps working:
+
+	```c++
+
+	NetAddress v4 = LS_LOOPBACK_IPV4;
+	NetAddress any = NetAddress::anyIPv6();		// binds a dual-stack socket that also sends to IPv4
+
+	NetAddress v6;
+	LsUtils::addressFromStr("fe80::1%eth0", v6);	// see LumasonicNet.h
+
+	```
+*/
+struct NetAddress
+{
+	/** @brief Constructor. Creates an empty address of the @ref LumasonicAddressFamilies::LS_Address_None family.*/
+	NetAddress()
+	{
+		family = LumasonicAddressFamilies::LS_Address_None;
+		memset(bytes, 0, sizeof(bytes));
+		scopeId = 0;
+	}
+
+	/** @brief Constructor. Creates an IPv4 address from its 4 byte unsigned int form.*/
+	NetAddress(unsigned int ipv4Address)
+	{
+		family = LumasonicAddressFamilies::LS_Address_IPv4;
+		memset(bytes, 0, sizeof(bytes));
+		bytes[0] = (unsigned char)(ipv4Address >> 24);
+		bytes[1] = (unsigned char)(ipv4Address >> 16);
+		bytes[2] = (unsigned char)(ipv4Address >> 8);
+		bytes[3] = (unsigned char)ipv4Address;
+		scopeId = 0;
+	}
+
+	/** @brief Creates an IPv6 address from its 16 bytes in network order and an optional scope ID.*/
+	static NetAddress fromIPv6(const unsigned char* ipv6Bytes, unsigned int ipv6ScopeId = 0)
+	{
+		NetAddress a;
+		a.family = LumasonicAddressFamilies::LS_Address_IPv6;
+		memcpy(a.bytes, ipv6Bytes, 16);
+		a.scopeId = ipv6ScopeId;
+		return a;
+	}
+
+	/** @brief Creates the IPv6 unspecified address (::). Binding to it opens a dual-stack socket.*/
+	static NetAddress anyIPv6()
+	{
+		const unsigned char zero[16] = {};
+		return fromIPv6(zero);
+	}
+
+	/** @brief Whether this is an IPv4 address.*/
+	bool isIPv4() const { return family == LumasonicAddressFamilies::LS_Address_IPv4; }
+
+	/** @brief Whether this is an IPv6 address.*/
+	bool isIPv6() const { return family == LumasonicAddressFamilies::LS_Address_IPv6; }
+
+	/** @brief Whether this is an IPv4 or IPv6 multicast group address.*/
+	bool isMulticast() const { return isIPv4() ? (bytes[0] >> 4) == 0xE : (isIPv6() && bytes[0] == 0xFF); }
+
+	/** @brief Gets the 4 byte unsigned int form of an IPv4 address, or 0 for other families.*/
+	unsigned int toIPv4() const
+	{
+		if (!isIPv4())
+			return 0;
+
+		return ((unsigned int)bytes[0] << 24) | ((unsigned int)bytes[1] << 16) | ((unsigned int)bytes[2] << 8) | bytes[3];
+	}
+
+	/** @brief Compares two addresses for equality.*/
+	bool operator==(const NetAddress& a) const
+	{
+		return family == a.family && scopeId == a.scopeId && memcmp(bytes, a.bytes, sizeof(bytes)) == 0;
+	}
+
+	/** @brief Compares two addresses for inequality.*/
+	bool operator!=(const NetAddress& a) const { return !(*this == a); }
+
+	LumasonicAddressFamilies family;	///< The address family.
+	unsigned char bytes[16];			///< The address bytes in network order; only the first 4 are used by IPv4.
+	unsigned int scopeId;				///< The IPv6 scope ID (network interface index) of link-local addresses, or 0.
+};
+
+//==============================================================================
+/**
+	@brief Contains network/socket configuration settings for the @ref LumasonicStereoUdpBatchListener
+	class, with IPv4 or IPv6 addresses.
+
+	@details
+	Same as @ref UdpListenerConfig, using @ref NetAddress for the local and remote addresses.
+	Binding to @ref NetAddress::anyIPv6() opens a dual-stack socket that can send to
+	IPv4 and IPv6 hosts.
+*/
+struct UdpListenerAddressConfig
+{
+	NetAddress localAddress;		///< The IPv4 or IPv6 address of the local interface to use
+	NetAddress remoteAddress;		///< The IPv4 or IPv6 address of the remote host to send to
+	unsigned short remotePort;      ///< The remote port number to send to.
+	unsigned short localPort;       ///< The local port number to bind to. Use 0 to automatically select an open local port.
+	bool exclusive;                 ///< Whether the socket will bind in exclusive mode or share socket with other processes.
+};
+
+//==============================================================================
+/**
+	@brief Contains network/socket configuration settings for the @ref LumasonicStereoUdpReceiver class.
+*/
+struct UdpReceiverConfig
+{
+	NetAddress localAddress;		///< The IPv4 or IPv6 address of the local interface to receive on. An empty or 0 address receives IPv4 on any interface, and @ref NetAddress::anyIPv6() receives both.
+	unsigned short localPort;       ///< The local port number to bind to.
+	bool exclusive;                 ///< Whether the socket will bind in exclusive mode or share socket with other processes.
+	NetAddress multicastGroup;		///< The IPv4 or IPv6 multicast group to join, or an empty or 0 address to receive unicast and broadcast datagrams only.
+	int receiveBufferSize;			///< The size in bytes of the kernel buffer that absorbs bursts while listeners run, or 0 for the system default.
+};
+
+//==============================================================================
+/**
+	@brief A remote host and port that a UDP listener sends to.
+*/
+struct UdpEndpoint
+{
+	NetAddress address;				///< The IPv4 or IPv6 address of the remote host or multicast group
+	unsigned short port;			///< The remote port number to send to.
+};
+
+//==============================================================================
+/**
+	@brief Contains network/socket configuration settings for a UDP listener that sends
+	the same stream to several remote endpoints from one socket.
+
+	@details
+	Each sample is serialized once and the same bytes are sent to every destination.
+	A destination whose address is a multicast group (224.0.0.0 - 239.255.255.255 or ff00::/8)
+	is sent to using the multicast TTL and interface below.
+
+	With an IPv6 local address, the interface of IPv6 multicast datagrams is the scope ID
+	of the local address, and @ref NetAddress::anyIPv6() opens a dual-stack socket that
+	can reach IPv4 and IPv6 destinations.
+*/
+struct UdpFanOutConfig
+{
+	NetAddress localAddress;		///< The IPv4 or IPv6 address of the local interface to use
+	unsigned short localPort;       ///< The local port number to bind to. Use 0 to automatically select an open local port.
+	bool exclusive;                 ///< Whether the socket will bind in exclusive mode or share socket with other processes.
+
+	UdpEndpoint destinations[LS_UDP_MAX_DESTINATIONS];	///< The remote endpoints to send to.
+	int numDestinations;			///< The number of valid entries in destinations, from 0 to @ref LS_UDP_MAX_DESTINATIONS.
+
+	unsigned char multicastTtl;		///< The time to live (IPv6 hop limit) of multicast datagrams. Use 0 for the system default (1, local network only).
+	unsigned int multicastInterface;///< The IPv4 address of the interface multicast datagrams leave from. Use 0 for the system default.
+	bool multicastLoopback;			///< Whether multicast datagrams are also delivered to receivers on this host.
+};
+
+//==============================================================================
+/**
+	@brief The physical layouts of LED bars driven by a pixel listener, matching
+	the `LED Bar Layout` setting of the Prism sACN module.
+*/
+enum class LumasonicLedBarLayouts
+{
+	LS_Layout_1x1 = 0,			///< Single LED bar showing both channels mixed
+	LS_Layout_1x2,				///< Single LED bar, split in the middle: left channel on the first half, right on the second
+	LS_Layout_2x1,				///< Two LED bars (outputs A and B), one per channel (L/R)
+	LS_Layout_2x2,				///< Two pairs of LED bars (outputs A+B and C+D), each pair acting as one channel (L/R)
+	LS_Layout_4x1				///< Four LED bars with the same mixed signal duplicated to each one
+};
+
+/**
+	@brief The DMX encodings of a pixel, matching the `Color Encoding` setting of the Prism sACN module.
+*/
+enum class LumasonicPixelEncodings
+{
+	LS_Pixel_RGB8 = 0,			///< 3 channels per pixel, 8 bits per color
+	LS_Pixel_RGBW8,				///< 4 channels per pixel, 8 bits per color, with the common white part moved to W
+	LS_Pixel_RGB16				///< 6 channels per pixel, 16 bits per color (coarse then fine)
+};
+
+/**
+	@brief The ways samples are drawn onto the pixels of the LED bars, matching the
+	`Pixel Update Mode` setting of the Prism sACN module.
+
+	@details
+	Fill modes move one pixel per frame: each new sample enters the bar (or half bar
+	with @ref LumasonicLedBarLayouts::LS_Layout_1x2) and pushes the older ones along it.
+*/
+enum class LumasonicPixelEffects
+{
+	LS_Effect_Stereo_Color = 0,	///< Every pixel of a bar shows the current sample
+	LS_Effect_Forward_Fill,		///< New samples enter at the first pixel (closest to the input cable) and move toward the last one
+	LS_Effect_Backward_Fill,	///< New samples enter at the last pixel (furthest from the input cable) and move toward the first one
+	LS_Effect_Ping_Pong_Fill	///< Like forward fill, reversing direction each time the bar has been filled
+};
+
+/**
+	@brief The settings of one pixel output (LED bar) of a lighting controller.
+*/
+struct PixelOutputConfig
+{
+	bool enabled;					///< Whether the output is lit. Disabled outputs keep their channels but send black.
+	float dimmer;					///< The brightness of the output, from 0 to 1.
+	bool invert;					///< Swaps the left and right channels on this output, for bars facing the other way.
+};
+
+/**
+	@brief Describes how stereo color samples are mapped onto the pixels of up to
+	@ref LS_PIXEL_NUM_OUTPUTS LED bars and packed into DMX universes.
+
+	@details
+	Pixels are numbered bar by bar (output A first) and packed into consecutive
+	universes. A pixel never straddles two universes, so a universe holds
+	170 RGB8, 128 RGBW8 or 85 RGB16 pixels.
+*/
+struct PixelMapConfig
+{
+	LumasonicLedBarLayouts layout;	///< The physical layout of the LED bars.
+	int pixelsPerBar;				///< The number of pixels (LEDs) of each bar.
+	LumasonicPixelEncodings encoding;	///< The DMX encoding of each pixel.
+	PixelOutputConfig outputs[LS_PIXEL_NUM_OUTPUTS];	///< The settings of outputs A to D.
+	LumasonicPixelEffects effect;	///< How samples are drawn onto the pixels.
+	float frameDecay;				///< The time in seconds a pixel takes to fade from full brightness to black once it is no longer lit (`Pixel Frame Decay`). 0 disables decay.
+};
+
+//==============================================================================
+/**
+	@brief Contains network and pixel mapping settings for the @ref LumasonicSacnListener class.
+*/
+struct SacnListenerConfig
+{
+	unsigned int localAddress;		///< The IPv4 address of the local interface to use, as a 4 byte unsigned int
+	unsigned int remoteAddress;		///< The IPv4 address of the lighting controller, or 0 to send to the standard sACN multicast group of each universe.
+	unsigned short remotePort;      ///< The remote port number to send to. Use 0 for the standard sACN port (@ref LS_SACN_PORT).
+	unsigned short startUniverse;	///< The first universe to send (1 - 63999).
+	unsigned char priority;			///< The sACN priority of the data (0 - 200, 100 is the sACN default).
+	char sourceName[LS_SACN_SOURCE_NAME_SIZE];	///< The source name shown by sACN monitoring tools (UTF-8, null terminated).
+	double frameRateLimit;			///< The maximum number of frames sent per second, or 0 to send a frame for every sample.
+	PixelMapConfig pixelMap;		///< How samples are mapped onto pixels and universes.
+};
+
+//==============================================================================
+/**
+	@brief Contains network and pixel mapping settings for the @ref LumasonicArtNetListener class.
+*/
+struct ArtNetListenerConfig
+{
+	unsigned int localAddress;		///< The IPv4 address of the local interface to use, as a 4 byte unsigned int
+	unsigned int remoteAddress;		///< The IPv4 address of the Art-Net node, or a broadcast address such as 2.255.255.255. Use 0 for the limited broadcast address 255.255.255.255.
+	unsigned short remotePort;      ///< The remote port number to send to. Use 0 for the standard Art-Net port (@ref LS_ARTNET_PORT).
+	unsigned short startUniverse;	///< The first 15-bit Art-Net port address (net, sub-net and universe) to send (0 - 32767).
+	bool sync;						///< Whether to send an ArtSync packet after each frame so all nodes update their outputs together.
+	double frameRateLimit;			///< The maximum number of frames sent per second, or 0 to send a frame for every sample.
+	PixelMapConfig pixelMap;		///< How samples are mapped onto pixels and universes.
+};
@@ -26,7 +26,17 @@
 
 #include "LumasonicCommon.h"
 #include "LumasonicStereoDecoder.h"
+#include "LumasonicMultichannelDecoder.h"
+#include "LumasonicStreamEncoder.h"
 #include "LumasonicStereoReader.h"
+#include "LumasonicStereoMultiReader.h"
 #include "LumasonicStereoUdpListener.h"
+#include "LumasonicCallbackListener.h"
+#include "LumasonicPacket.h"
+#include "LumasonicPixelMap.h"
+#include "LumasonicPixelEffects.h"
+#include "LumasonicCoalescingListener.h"
+#include "LumasonicPacingListener.h"
+#include "LumasonicLevelMonitor.h"
 #include "LumasonicCodec.h"
 #include "LumasonicDecoderApi.h"
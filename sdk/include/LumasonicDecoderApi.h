@@ -454,6 +454,10 @@ int ls_listener_create(int type_id);
 
 //==============================================================================
 /** @brief Configures the network settings for an existing [UDP listener](@ref LumasonicStereoUdpListener) instance.
+
+	> [!NOTE]
+	> UDP listeners created through the C API only support IPv4 addresses.
+
 	@param id                   The ID of the listener instance.
 	@param local_address        The local IPv4 address to use (as a 4 byte integer). This selects the local network interface. Use @ref ls_convert_str_to_ipv4_address() to convert from a string address.
 	@param local_port			The local port number to use when binding to the socket for sending.
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPerfStats.h"
+#include <atomic>
+#include <mutex>
+
+//==============================================================================
+/**
+ * @brief A listener that keeps the most recent @ref StereoColorSample of a reader
+ * so that other threads can read all six levels in one consistent call.
+ *
+ * @details
+ * Reading the levels of a decoder with the six `getRedLevelL()` ... `getBlueLevelR()`
+ * getters takes six separate loads, and an update from the audio thread can land
+ * between any two of them. The level monitor is registered with a reader like any
+ * other listener; it publishes every sample it receives through a sequence lock, and
+ * @ref getLevels copies all six levels and the timestamp from the same sample.
+ *
+ * Polling never blocks the reader's thread: a poll only retries if it raced with a
+ * sample being published. This makes the monitor suited to user interfaces that poll
+ * the levels of many decoders.
+ *
+ * ```c++
+ *
+ * LumasonicLevelMonitor monitor;
+ * lsReader->addListener(&monitor);
+ *
+ * StereoColorSample levels;                    // on the UI thread
+ * if (monitor.getLevels(levels))
+ *      drawLevels(levels.r0, levels.g0, levels.b0, levels.r1, levels.g1, levels.b1);
+ *
+ * ```
+ *
+ * > [!NOTE]
+ * > The monitor can be registered with several readers. Samples arriving from different
+ * > threads are published one at a time, and @ref getLevels returns whichever arrived last.
+ */
+class LumasonicLevelMonitor : public LumasonicStereoColorListener
+{
+public:
+    //==============================================================================
+    /** @brief Constructor*/
+    LumasonicLevelMonitor() = default;
+
+    /** @brief Destructor*/
+    ~LumasonicLevelMonitor() override = default;
+
+    //==============================================================================
+    /** @brief Copies the most recent sample received from the reader. This method is thread-safe and lock-free.
+        @param levels               The sample that will be assigned the left and right red, green and blue levels and their timestamp.
+        @return                     True if a sample has been received, False if not (the sample is left unaltered).
+    */
+    bool getLevels(StereoColorSample& levels) const { return published.load(levels); }
+
+    /** @brief Gets the total number of samples received from the reader.*/
+    unsigned long long getNumSamplesReceived() const { return numReceived.load(); }
+
+    //==============================================================================
+    /** @brief Publishes a new sample. Called on the reader's thread.
+        @param process              A reference to the running process that called this listener.
+        @param stereoColor          The stereo color sample value that has been read.
+    */
+    void onStereoColorRead(LumasonicRunningProcess& /*process*/, StereoColorSample stereoColor) override
+    {
+        // The sequence lock allows one writer at a time; only readers sharing the monitor ever contend here
+        {
+            std::lock_guard<std::mutex> lock(writeLock);
+            published.store(stereoColor);
+        }
+
+        numReceived.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    //==============================================================================
+    LsUtils::SeqLock<StereoColorSample> published;
+    std::mutex writeLock;
+    std::atomic<unsigned long long> numReceived { 0 };
+};
@@ -0,0 +1,235 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicStereoDecoder.h"
+#include "LumasonicUtils.h"
+#include <algorithm>
+#include <vector>
+
+//==============================================================================
+/**
+ * @brief Decodes several stereo pairs carried by one multi-channel audio device
+ * buffer, using one @ref LumasonicStereoDecoder per pair.
+ *
+ * @details
+ * A @ref LumasonicStereoDecoder takes two separate channel buffers, so a host
+ * running four stations off one 10 channel interface would otherwise de-interleave
+ * the whole device buffer and call four decoders itself. The multichannel decoder
+ * takes the device buffer as it arrives together with a pair map (which decoder
+ * reads which two adjacent channels) and decodes every pair in one call.
+ *
+ * All pairs share one preallocated pair of scratch buffers sized by @ref reset().
+ * Each pair is de-interleaved into the scratch buffers with
+ * @ref LsUtils::deinterleaveChannelPair() right before its decoder runs, so the
+ * samples are still in cache when they are decoded and nothing is allocated on
+ * the audio thread. Blocks longer than the scratch buffers are decoded in chunks.
+ *
+ * The decoders stay owned by the caller and are read as usual, for example with a
+ * @ref LumasonicStereoMultiReader.
+ *
+ * ### Building the Pair Map
+ *
+ * ```c++
+ *
+ * auto* lsMultichannel = new LumasonicMultichannelDecoder();
+ *
+ * lsMultichannel->addPair(lsDecoderA, 0);     // inputs 1 + 2
+ * lsMultichannel->addPair(lsDecoderB, 2);     // inputs 3 + 4
+ * lsMultichannel->addPair(lsDecoderC, 4);     // inputs 5 + 6
+ * lsMultichannel->addPair(lsDecoderD, 6);     // inputs 7 + 8
+ *
+ * lsMultichannel->reset(48000.f, 256);        // resets every decoder and sizes the scratch buffers
+ *
+ * ```
+ *
+ * ### Processing Device Buffers
+ *
+ * ```c++
+ *
+ * // interleaved device buffer, 10 samples per frame
+ * lsMultichannel->processBlock(deviceBuffer, 10, numFrames);
+ *
+ * // or one buffer per channel (ASIO, CoreAudio, JACK, JUCE); no copy is made
+ * lsMultichannel->processBlock(channelBuffers, 10, numFrames);
+ *
+ * ```
+ *
+ * Pairs whose channels are not in the buffer (a device with fewer channels than
+ * the map expects) are skipped.
+ *
+ * > [!NOTE]
+ * > The pair map and the scratch buffers are not locked. Only change the map or
+ * > call @ref reset() while no audio is being processed, the same as resetting a
+ * > single decoder.
+ */
+class LumasonicMultichannelDecoder
+{
+public:
+    //==============================================================================
+    /** @brief Constructor*/
+    LumasonicMultichannelDecoder() = default;
+
+    //==============================================================================
+    /** @brief The unique ID of the instance.*/
+    int id = -1;
+
+    /** @brief Adds a decoder to the pair map, or moves it to another pair if it was already added.
+        @param decoder              A pointer to the decoder that will decode the pair.
+        @param firstChannel         The index of the first channel of the pair in the device buffer, starting at 0.
+        @return                     True if the pair was added, False if the decoder was null or the channel was negative.
+    */
+    bool addPair(LumasonicStereoDecoder* decoder, int firstChannel)
+    {
+        if (decoder == nullptr || firstChannel < 0)
+            return false;
+
+        for (auto& pair : pairs)
+        {
+            if (pair.decoder == decoder)
+            {
+                pair.firstChannel = firstChannel;
+                return true;
+            }
+        }
+
+        pairs.push_back({ decoder, firstChannel });
+        return true;
+    }
+
+    /** @brief Removes a decoder from the pair map.
+        @param decoder              A pointer to the decoder to remove.
+        @return                     True if the decoder was removed, False if it was not found.
+    */
+    bool removePair(LumasonicStereoDecoder* decoder)
+    {
+        auto it = std::find_if(pairs.begin(), pairs.end(), [decoder](const Pair& p) { return p.decoder == decoder; });
+
+        if (it == pairs.end())
+            return false;
+
+        pairs.erase(it);
+        return true;
+    }
+
+    /** @brief Removes every pair from the pair map.*/
+    void clearPairs() { pairs.clear(); }
+
+    /** @brief Gets the number of pairs in the pair map.*/
+    int getNumPairs() const { return (int)pairs.size(); }
+
+    /** @brief Gets the number of device channels needed for every pair of the map to be decoded.*/
+    int getNumChannelsRequired() const
+    {
+        int required = 0;
+
+        for (auto& pair : pairs)
+            required = (std::max)(required, pair.firstChannel + 2);
+
+        return required;
+    }
+
+    //==============================================================================
+    /** @brief Initializes every decoder of the pair map and sizes the shared scratch buffers.
+        See @ref LumasonicStereoDecoder::reset().
+        @param sampleRate           The number of samples per second of the audio signal.
+        @param bufferSize           The maximum number of audio frames per device buffer processed.
+    */
+    void reset(float sampleRate, int bufferSize)
+    {
+        bufferSize = (std::max)(1, bufferSize);
+
+        scratch0.assign((size_t)bufferSize, 0.f);
+        scratch1.assign((size_t)bufferSize, 0.f);
+
+        for (auto& pair : pairs)
+            pair.decoder->reset(sampleRate, bufferSize);
+    }
+
+    /** @brief Decodes every pair of an interleaved device buffer. This method should be called from the audio thread only.
+        @param input                The interleaved device buffer, numChannels samples per frame.
+        @param numChannels          The number of interleaved channels in the device buffer.
+        @param numSamples           The number of frames (samples per channel) in the device buffer.
+    */
+    void processBlock(const float* input, int numChannels, int numSamples)
+    {
+        if (input == nullptr || numSamples <= 0 || scratch0.empty())
+            return;
+
+        const int chunkSize = (int)scratch0.size();
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int count = (std::min)(chunkSize, numSamples - start);
+            const float* frames = input + (size_t)start * (size_t)numChannels;
+
+            for (auto& pair : pairs)
+            {
+                if (!LsUtils::deinterleaveChannelPair(frames, numChannels, pair.firstChannel, scratch0.data(), scratch1.data(), count))
+                    continue;
+
+                pair.decoder->processBlock(scratch0.data(), scratch1.data(), count);
+            }
+        }
+    }
+
+    /** @brief Decodes every pair of a device buffer with one buffer per channel. This method should be called from the audio thread only.
+        The channel buffers are passed to the decoders directly, so the scratch buffers are not used.
+        @param channels             An array of numChannels channel buffers. Pairs with a nullptr channel are skipped.
+        @param numChannels          The number of channels of the device.
+        @param numSamples           The number of samples in each channel buffer.
+    */
+    void processBlock(const float* const* channels, int numChannels, int numSamples)
+    {
+        if (channels == nullptr || numSamples <= 0)
+            return;
+
+        for (auto& pair : pairs)
+        {
+            if (pair.firstChannel + 1 >= numChannels)
+                continue;
+
+            const float* in0 = channels[pair.firstChannel];
+            const float* in1 = channels[pair.firstChannel + 1];
+
+            if (in0 != nullptr && in1 != nullptr)
+                pair.decoder->processBlock(in0, in1, numSamples);
+        }
+    }
+
+private:
+    //==============================================================================
+    struct Pair
+    {
+        LumasonicStereoDecoder* decoder;
+        int firstChannel;
+    };
+
+    std::vector<Pair> pairs;
+    std::vector<float> scratch0;    // shared by every pair, sized by reset()
+    std::vector<float> scratch1;
+};
@@ -0,0 +1,798 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPacket.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+// Keep windows.h (pulled in by winsock2.h) from defining min/max macros and the old winsock.h API.
+// The macros are only defined for these includes, so hosts see the same settings they had before.
+#ifndef NOMINMAX
+#define NOMINMAX
+#define LS_NET_UNDEF_NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define LS_NET_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <iphlpapi.h>
+#ifdef LS_NET_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef LS_NET_UNDEF_NOMINMAX
+#endif
+#ifdef LS_NET_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef LS_NET_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#pragma comment(lib, "ws2_32.lib")
+#pragma comment(lib, "iphlpapi.lib")
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+// The maximum number of datagrams sent or received by a single batched socket call
+#ifndef LS_UDP_MAX_BATCH
+#define LS_UDP_MAX_BATCH            64
+#endif
+
+// The maximum number of payload bytes of a single datagram built by the SDK (fits a 1500 byte Ethernet MTU)
+#ifndef LS_UDP_MAX_PAYLOAD_SIZE
+#define LS_UDP_MAX_PAYLOAD_SIZE     1400
+#endif
+
+// The number of bytes of each receive buffer; longer datagrams are truncated
+#ifndef LS_UDP_RECEIVE_BUFFER_SIZE
+#define LS_UDP_RECEIVE_BUFFER_SIZE  2048
+#endif
+
+namespace LsUtils
+{
+    //==============================================================================
+    /** @brief A datagram to send with @ref UdpSocket::sendBatch().*/
+    struct UdpMessage
+    {
+        const void* data;           ///< The payload to send.
+        size_t size;                ///< The number of payload bytes.
+        NetAddress address;         ///< The IPv4 or IPv6 address to send to.
+        unsigned short port;        ///< The port number to send to.
+    };
+
+    /** @brief A receive buffer filled by @ref UdpSocket::receiveBatch().*/
+    struct UdpReceivedMessage
+    {
+        unsigned char* data;        ///< The buffer the payload is written to.
+        size_t capacity;            ///< The number of bytes of the buffer.
+        size_t size;                ///< The number of payload bytes received.
+        NetAddress address;         ///< The IPv4 or IPv6 address of the sender.
+        unsigned short port;        ///< The port number of the sender.
+    };
+
+    //==============================================================================
+    /** @brief Converts an address and port into a socket address for a socket of the given family.
+        IPv4 addresses are mapped into IPv6 (::ffff:a.b.c.d) for IPv6 sockets, and an empty
+        address becomes the unspecified address of the socket's family.
+        @param address          The address to convert.
+        @param port             The port number.
+        @param ipv6Socket       Whether the socket address is for an IPv6 (dual-stack) socket.
+        @param out              Receives the socket address.
+        @return                 The size of the socket address, or 0 if an IPv6 address was given for an IPv4 socket.
+    */
+    inline socklen_t toSockAddr(const NetAddress& address, unsigned short port, bool ipv6Socket, sockaddr_storage& out)
+    {
+        std::memset(&out, 0, sizeof(out));
+
+        if (!ipv6Socket)
+        {
+            if (address.isIPv6())
+                return 0;
+
+            auto& in = reinterpret_cast<sockaddr_in&>(out);
+            in.sin_family = AF_INET;
+            in.sin_addr.s_addr = htonl(address.toIPv4());
+            in.sin_port = htons(port);
+            return (socklen_t)sizeof(sockaddr_in);
+        }
+
+        auto& in6 = reinterpret_cast<sockaddr_in6&>(out);
+        in6.sin6_family = AF_INET6;
+        in6.sin6_port = htons(port);
+
+        if (address.isIPv6())
+        {
+            std::memcpy(&in6.sin6_addr, address.bytes, 16);
+            in6.sin6_scope_id = address.scopeId;
+        }
+        else if (address.isIPv4())
+        {
+            auto* b = reinterpret_cast<unsigned char*>(&in6.sin6_addr);
+            b[10] = b[11] = 0xFF;
+            std::memcpy(b + 12, address.bytes, 4);
+        }
+
+        return (socklen_t)sizeof(sockaddr_in6);
+    }
+
+    /** @brief Converts a socket address into an address. IPv4-mapped IPv6 addresses become IPv4 addresses.*/
+    inline NetAddress fromSockAddr(const sockaddr* addr)
+    {
+        if (addr == nullptr)
+            return NetAddress();
+
+        if (addr->sa_family == AF_INET)
+            return NetAddress((unsigned int)ntohl(reinterpret_cast<const sockaddr_in*>(addr)->sin_addr.s_addr));
+
+        if (addr->sa_family != AF_INET6)
+            return NetAddress();
+
+        const auto* in6 = reinterpret_cast<const sockaddr_in6*>(addr);
+        const auto* b = reinterpret_cast<const unsigned char*>(&in6->sin6_addr);
+        static const unsigned char mappedPrefix[12] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF };
+
+        if (std::memcmp(b, mappedPrefix, sizeof(mappedPrefix)) == 0)
+            return NetAddress(((unsigned int)b[12] << 24) | ((unsigned int)b[13] << 16) | ((unsigned int)b[14] << 8) | b[15]);
+
+        return NetAddress::fromIPv6(b, in6->sin6_scope_id);
+    }
+
+    /** @brief Gets the port number of a socket address.*/
+    inline unsigned short portFromSockAddr(const sockaddr* addr)
+    {
+        if (addr != nullptr && addr->sa_family == AF_INET)
+            return ntohs(reinterpret_cast<const sockaddr_in*>(addr)->sin_port);
+
+        if (addr != nullptr && addr->sa_family == AF_INET6)
+            return ntohs(reinterpret_cast<const sockaddr_in6*>(addr)->sin6_port);
+
+        return 0;
+    }
+
+    /** @brief Parses an IPv4 ("192.168.1.10") or IPv6 ("fd00::10", "fe80::1%eth0", "fe80::1%12") address string.
+        @param str              The address string. An IPv6 scope may be given as an interface name or index.
+        @param address          Receives the address. It is left unaltered if parsing fails.
+        @return                 True if the string was a valid address, False if not.
+    */
+    inline bool addressFromStr(const char* str, NetAddress& address)
+    {
+        if (str == nullptr)
+            return false;
+
+        unsigned char bytes[16];
+
+        if (inet_pton(AF_INET, str, bytes) == 1)
+        {
+            address = NetAddress(((unsigned int)bytes[0] << 24) | ((unsigned int)bytes[1] << 16) | ((unsigned int)bytes[2] << 8) | bytes[3]);
+            return true;
+        }
+
+        char host[LS_NET_ADDRESS_STR_SIZE];
+        std::strncpy(host, str, sizeof(host) - 1);
+        host[sizeof(host) - 1] = 0;
+
+        unsigned int scope = 0;
+        char* percent = std::strchr(host, '%');
+
+        if (percent != nullptr)
+        {
+            *percent = 0;
+            const char* zone = percent + 1;
+            char* end = nullptr;
+            auto index = std::strtoul(zone, &end, 10);
+
+            scope = (end != zone && *end == 0) ? (unsigned int)index : if_nametoindex(zone);
+            if (scope == 0)
+                return false;
+        }
+
+        if (inet_pton(AF_INET6, host, bytes) != 1)
+            return false;
+
+        address = NetAddress::fromIPv6(bytes, scope);
+        return true;
+    }
+
+    /** @brief Formats an address as a string, with a "%index" suffix for IPv6 addresses with a scope ID.
+        @param address          The address to format.
+        @param str              The char buffer to write the string into.
+        @param size             The size of the buffer, at least @ref LS_NET_ADDRESS_STR_SIZE bytes for any address.
+        @return                 True if the address was formatted, False if it was empty or the buffer too small.
+    */
+    inline bool addressToStr(const NetAddress& address, char* str, size_t size = LS_NET_ADDRESS_STR_SIZE)
+    {
+        if (str == nullptr || size == 0 || (!address.isIPv4() && !address.isIPv6()))
+            return false;
+
+        unsigned char copy[16];
+        std::memcpy(copy, address.bytes, sizeof(copy));
+
+        if (inet_ntop(address.isIPv4() ? AF_INET : AF_INET6, copy, str, (socklen_t)size) == nullptr)
+            return false;
+
+        if (address.isIPv6() && address.scopeId != 0)
+        {
+            size_t length = std::strlen(str);
+            int written = std::snprintf(str + length, size - length, "%%%u", address.scopeId);
+
+            if (written < 0 || (size_t)written >= size - length)
+                return false;
+        }
+
+        return true;
+    }
+
+    //==============================================================================
+    /** @brief An address of a network interface, listed by @ref getNetworkInterfaces().*/
+    struct NetworkInterface
+    {
+        char name[LS_NET_INTERFACE_NAME_SIZE];  ///< The name of the interface (such as "eth0"; the adapter name on Windows).
+        unsigned int index;                     ///< The interface index, used as the scope ID of its link-local IPv6 addresses.
+        NetAddress address;                     ///< The IPv4 or IPv6 address; link-local IPv6 addresses carry the interface index as scope ID.
+    };
+
+    /** @brief Lists the IPv4 and IPv6 addresses of the network interfaces that are up.
+        An interface with several addresses has one entry for each.
+        @param interfaces       The array that receives the entries.
+        @param maxCount         The size of the array.
+        @return                 The number of entries written.
+    */
+    inline int getNetworkInterfaces(NetworkInterface* interfaces, int maxCount)
+    {
+        if (interfaces == nullptr || maxCount <= 0)
+            return 0;
+
+        int count = 0;
+
+        auto add = [&](const char* name, unsigned int index, const sockaddr* addr)
+        {
+            if (count >= maxCount || addr == nullptr || (addr->sa_family != AF_INET && addr->sa_family != AF_INET6))
+                return;
+
+            auto& entry = interfaces[count++];
+            std::memset(entry.name, 0, sizeof(entry.name));
+            std::strncpy(entry.name, name, sizeof(entry.name) - 1);
+            entry.index = index;
+            entry.address = fromSockAddr(addr);
+
+            // Only link-local addresses need the scope to be reachable
+            if (entry.address.isIPv6() && entry.address.bytes[0] == 0xFE && (entry.address.bytes[1] & 0xC0) == 0x80)
+                entry.address.scopeId = index;
+            else
+                entry.address.scopeId = 0;
+        };
+
+#ifdef _WIN32
+        ULONG size = 16 * 1024;
+        IP_ADAPTER_ADDRESSES* adapters = nullptr;
+        ULONG result = ERROR_BUFFER_OVERFLOW;
+
+        for (int attempt = 0; attempt < 3 && result == ERROR_BUFFER_OVERFLOW; ++attempt)
+        {
+            std::free(adapters);
+            adapters = (IP_ADAPTER_ADDRESSES*)std::malloc(size);
+
+            if (adapters == nullptr)
+                return 0;
+
+            result = GetAdaptersAddresses(AF_UNSPEC, GAA_FLAG_SKIP_ANYCAST | GAA_FLAG_SKIP_MULTICAST | GAA_FLAG_SKIP_DNS_SERVER, nullptr, adapters, &size);
+        }
+
+        if (result == NO_ERROR)
+        {
+            for (auto* a = adapters; a != nullptr; a = a->Next)
+            {
+                if (a->OperStatus != IfOperStatusUp)
+                    continue;
+
+                for (auto* u = a->FirstUnicastAddress; u != nullptr; u = u->Next)
+                {
+                    auto* addr = u->Address.lpSockaddr;
+                    add(a->AdapterName, addr != nullptr && addr->sa_family == AF_INET6 ? a->Ipv6IfIndex : a->IfIndex, addr);
+                }
+            }
+        }
+
+        std::free(adapters);
+#else
+        ifaddrs* list = nullptr;
+
+        if (getifaddrs(&list) != 0)
+            return 0;
+
+        for (auto* i = list; i != nullptr; i = i->ifa_next)
+            if ((i->ifa_flags & IFF_UP) != 0)
+                add(i->ifa_name, if_nametoindex(i->ifa_name), i->ifa_addr);
+
+        freeifaddrs(list);
+#endif
+
+        return count;
+    }
+
+    //==============================================================================
+    /**
+     * @brief A minimal cross-platform IPv4 and IPv6 UDP socket used by the
+     * header-only network listeners of the SDK.
+     *
+     * @details
+     * Addresses are @ref NetAddress values, so the 4 byte unsigned ints of
+     * @ref UdpListenerConfig (for example @ref LS_LOOPBACK_IPV4) can be passed as is.
+     * Opening the socket on an IPv6 address creates an IPv6 socket that also reaches
+     * IPv4 hosts through IPv4-mapped addresses (dual-stack); opening it on
+     * @ref NetAddress::anyIPv6() is the usual way to serve both.
+     *
+     * @ref sendBatch() hands many datagrams to the kernel at once with `sendmmsg()`
+     * on Linux, and falls back to one `sendto()` per datagram elsewhere. Likewise
+     * @ref receiveBatch() pulls every waiting datagram with one `recvmmsg()` call on
+     * Linux, and one datagram per `recvfrom()` call elsewhere. The number of system
+     * calls made is counted so the cost of batching can be measured.
+     */
+    class UdpSocket
+    {
+    public:
+        /** @brief Constructor*/
+        UdpSocket() = default;
+
+        /** @brief Destructor. Closes the socket if it is open.*/
+        ~UdpSocket() { close(); }
+
+        UdpSocket(const UdpSocket&) = delete;
+        UdpSocket& operator=(const UdpSocket&) = delete;
+
+        /** @brief Opens and binds the socket. Any previously open socket is closed first.
+            @param localAddress     The IPv4 or IPv6 address of the local interface to bind to. An empty or 0 address binds
+                                    an IPv4 socket to any interface, and @ref NetAddress::anyIPv6() a dual-stack socket.
+            @param localPort        The local port number to bind to. Use 0 to automatically select an open local port.
+            @param exclusive        Whether the socket will bind in exclusive mode or share the address with other processes.
+            @return                 True if the socket was opened and bound, False if not.
+        */
+        bool open(const NetAddress& localAddress, unsigned short localPort, bool exclusive)
+        {
+            close();
+
+#ifdef _WIN32
+            WSADATA wsaData;
+            if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+                return false;
+
+            wsaStarted = true;
+#endif
+
+            ipv6 = localAddress.isIPv6();
+            scopeId = localAddress.scopeId;
+            handle = ::socket(ipv6 ? AF_INET6 : AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+            if (handle == invalidHandle)
+            {
+                close();
+                return false;
+            }
+
+            int one = 1;
+#ifdef _WIN32
+            setsockopt(handle, SOL_SOCKET, exclusive ? SO_EXCLUSIVEADDRUSE : SO_REUSEADDR, (const char*)&one, sizeof(one));
+#else
+            if (!exclusive)
+                setsockopt(handle, SOL_SOCKET, SO_REUSEADDR, (const char*)&one, sizeof(one));
+#endif
+
+            if (ipv6)
+            {
+                int zero = 0;
+                setsockopt(handle, IPPROTO_IPV6, IPV6_V6ONLY, (const char*)&zero, sizeof(zero));
+            }
+
+            sockaddr_storage local;
+            auto localSize = LsUtils::toSockAddr(localAddress, localPort, ipv6, local);
+
+            if (::bind(handle, (const sockaddr*)&local, localSize) != 0)
+            {
+                close();
+                return false;
+            }
+
+            return true;
+        }
+
+        /** @brief Closes the socket if it is open.*/
+        void close()
+        {
+            if (handle != invalidHandle)
+            {
+#ifdef _WIN32
+                ::closesocket(handle);
+#else
+                ::close(handle);
+#endif
+                handle = invalidHandle;
+            }
+
+#ifdef _WIN32
+            if (wsaStarted)
+                WSACleanup();
+
+            wsaStarted = false;
+#endif
+        }
+
+        /** @brief Whether the socket is currently open and bound.*/
+        bool isOpen() const { return handle != invalidHandle; }
+
+        /** @brief Whether the socket is an IPv6 (dual-stack) socket.*/
+        bool isIPv6() const { return ipv6; }
+
+        /** @brief Sends a single datagram.
+            @return                 True if the datagram was handed to the network stack, False if not.
+        */
+        bool send(const void* data, size_t size, const NetAddress& address, unsigned short port)
+        {
+            UdpMessage message { data, size, address, port };
+            return sendBatch(&message, 1) == 1;
+        }
+
+        /** @brief Sends a batch of datagrams using as few system calls as the platform allows.
+            A datagram that fails to send is skipped and the rest of the batch is still sent. IPv6 destinations
+            can't be reached from an IPv4 socket and are skipped.
+            @param messages         The datagrams to send.
+            @param count            The number of datagrams to send.
+            @param sentFlags        Optional array of count flags, set to whether each datagram was handed to the network stack.
+            @return                 The number of datagrams handed to the network stack.
+        */
+        int sendBatch(const UdpMessage* messages, int count, bool* sentFlags = nullptr)
+        {
+            if (sentFlags != nullptr)
+                for (int i = 0; i < count; ++i)
+                    sentFlags[i] = false;
+
+            if (!isOpen() || messages == nullptr)
+                return 0;
+
+            int sent = 0;
+
+#if defined(__linux__)
+            mmsghdr headers[LS_UDP_MAX_BATCH];
+            iovec vectors[LS_UDP_MAX_BATCH];
+            sockaddr_storage addresses[LS_UDP_MAX_BATCH];
+
+            for (int next = 0; next < count;)
+            {
+                int limit = count - next < LS_UDP_MAX_BATCH ? count - next : LS_UDP_MAX_BATCH;
+                int chunk = 0;
+
+                // A chunk ends before a destination the socket can't address
+                for (; chunk < limit; ++chunk)
+                {
+                    const auto& m = messages[next + chunk];
+                    auto addressSize = LsUtils::toSockAddr(m.address, m.port, ipv6, addresses[chunk]);
+
+                    if (addressSize == 0)
+                        break;
+
+                    vectors[chunk].iov_base = const_cast<void*>(m.data);
+                    vectors[chunk].iov_len = m.size;
+
+                    std::memset(&headers[chunk], 0, sizeof(mmsghdr));
+                    headers[chunk].msg_hdr.msg_name = &addresses[chunk];
+                    headers[chunk].msg_hdr.msg_namelen = addressSize;
+                    headers[chunk].msg_hdr.msg_iov = &vectors[chunk];
+                    headers[chunk].msg_hdr.msg_iovlen = 1;
+                }
+
+                if (chunk == 0)
+                {
+                    ++next;
+                    continue;
+                }
+
+                numSyscalls.fetch_add(1, std::memory_order_relaxed);
+                int result = ::sendmmsg(handle, headers, (unsigned int)chunk, 0);
+
+                // sendmmsg() stops at the first failing datagram; skip it and carry on after it
+                if (result < 0)
+                    result = 0;
+
+                if (sentFlags != nullptr)
+                    for (int i = 0; i < result; ++i)
+                        sentFlags[next + i] = true;
+
+                sent += result;
+                next += result < chunk ? result + 1 : result;
+            }
+#else
+            for (int i = 0; i < count; ++i)
+            {
+                const auto& m = messages[i];
+                sockaddr_storage remote;
+                auto remoteSize = LsUtils::toSockAddr(m.address, m.port, ipv6, remote);
+
+                if (remoteSize == 0)
+                    continue;
+
+                numSyscalls.fetch_add(1, std::memory_order_relaxed);
+
+                if (::sendto(handle, (const char*)m.data, (int)m.size, 0, (const sockaddr*)&remote, remoteSize) < 0)
+                    continue;
+
+                if (sentFlags != nullptr)
+                    sentFlags[i] = true;
+
+                ++sent;
+            }
+#endif
+
+            return sent;
+        }
+
+        /** @brief Waits for datagrams and receives as many as are available, using as few system calls as the platform allows.
+            Returns after the receive timeout (see @ref setReceiveTimeout()) if nothing arrives.
+            @param messages         The receive buffers. Their size, address and port are set for each datagram received.
+            @param count            The number of receive buffers.
+            @return                 The number of datagrams received, 0 on timeout, or -1 if the socket failed.
+        */
+        int receiveBatch(UdpReceivedMessage* messages, int count)
+        {
+            if (!isOpen() || messages == nullptr || count <= 0)
+                return -1;
+
+            count = count < LS_UDP_MAX_BATCH ? count : LS_UDP_MAX_BATCH;
+
+#if defined(__linux__)
+            mmsghdr headers[LS_UDP_MAX_BATCH];
+            iovec vectors[LS_UDP_MAX_BATCH];
+            sockaddr_storage addresses[LS_UDP_MAX_BATCH];
+
+            for (int i = 0; i < count; ++i)
+            {
+                vectors[i].iov_base = messages[i].data;
+                vectors[i].iov_len = messages[i].capacity;
+
+                std::memset(&headers[i], 0, sizeof(mmsghdr));
+                headers[i].msg_hdr.msg_name = &addresses[i];
+                headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+                headers[i].msg_hdr.msg_iov = &vectors[i];
+                headers[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            // Block for the first datagram only, then take whatever else is already queued
+            numReceiveSyscalls.fetch_add(1, std::memory_order_relaxed);
+            int result = ::recvmmsg(handle, headers, (unsigned int)count, MSG_WAITFORONE, nullptr);
+
+            if (result < 0)
+                return isTimeout() ? 0 : -1;
+
+            for (int i = 0; i < result; ++i)
+            {
+                messages[i].size = headers[i].msg_len;
+                messages[i].address = fromSockAddr((const sockaddr*)&addresses[i]);
+                messages[i].port = portFromSockAddr((const sockaddr*)&addresses[i]);
+            }
+
+            return result;
+#else
+            sockaddr_storage remote;
+            socklen_t remoteSize = sizeof(remote);
+
+            numReceiveSyscalls.fetch_add(1, std::memory_order_relaxed);
+            auto result = ::recvfrom(handle, (char*)messages[0].data, (int)messages[0].capacity, 0, (sockaddr*)&remote, &remoteSize);
+
+            if (result < 0)
+                return isTimeout() ? 0 : -1;
+
+            messages[0].size = (size_t)result;
+            messages[0].address = fromSockAddr((const sockaddr*)&remote);
+            messages[0].port = portFromSockAddr((const sockaddr*)&remote);
+            return 1;
+#endif
+        }
+
+        /** @brief Sets how long @ref receiveBatch() waits for a datagram. The socket must be open.
+            @param milliseconds     The longest wait in milliseconds, or 0 to wait forever.
+            @return                 True if the option was applied, False if not.
+        */
+        bool setReceiveTimeout(int milliseconds)
+        {
+            if (!isOpen())
+                return false;
+
+#ifdef _WIN32
+            DWORD value = (DWORD)milliseconds;
+#else
+            timeval value;
+            value.tv_sec = milliseconds / 1000;
+            value.tv_usec = (milliseconds % 1000) * 1000;
+#endif
+            return setsockopt(handle, SOL_SOCKET, SO_RCVTIMEO, (const char*)&value, sizeof(value)) == 0;
+        }
+
+        /** @brief Sets the size of the kernel buffer that holds datagrams until they are received. The socket must be open.
+            @param bytes            The requested buffer size in bytes. The system may round or cap it.
+            @return                 True if the option was applied, False if not.
+        */
+        bool setReceiveBufferSize(int bytes)
+        {
+            if (!isOpen())
+                return false;
+
+            return setsockopt(handle, SOL_SOCKET, SO_RCVBUF, (const char*)&bytes, sizeof(bytes)) == 0;
+        }
+
+        /** @brief Joins a multicast group to receive the datagrams sent to it. The socket must be open.
+            @param groupAddress     The IPv4 or IPv6 address of the multicast group.
+            @param interfaceAddress The IPv4 address of the interface to receive IPv4 groups on, or 0 to let the system choose.
+                                    IPv6 groups are joined on the interface of the group's scope ID, or else of the socket's local address.
+            @return                 True if the group was joined, False if not.
+        */
+        bool joinMulticastGroup(const NetAddress& groupAddress, unsigned int interfaceAddress)
+        {
+            if (!isOpen() || !groupAddress.isMulticast() || (groupAddress.isIPv6() && !ipv6))
+                return false;
+
+            if (groupAddress.isIPv6())
+            {
+                ipv6_mreq request;
+                std::memcpy(&request.ipv6mr_multiaddr, groupAddress.bytes, 16);
+                request.ipv6mr_interface = groupAddress.scopeId != 0 ? groupAddress.scopeId : scopeId;
+                return setsockopt(handle, IPPROTO_IPV6, IPV6_JOIN_GROUP, (const char*)&request, sizeof(request)) == 0;
+            }
+
+            ip_mreq request;
+            request.imr_multiaddr.s_addr = htonl(groupAddress.toIPv4());
+            request.imr_interface.s_addr = htonl(interfaceAddress);
+            return setsockopt(handle, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char*)&request, sizeof(request)) == 0;
+        }
+
+        /** @brief Sets how multicast datagrams are sent from this socket. The socket must be open.
+            On an IPv6 socket, IPv6 multicast datagrams leave from the interface of the local address's scope ID.
+            @param ttl              The time to live (hop limit) of multicast datagrams. Use 0 to keep the system default.
+            @param interfaceAddress The IPv4 address of the interface IPv4 multicast datagrams leave from. Use 0 to keep the system default.
+            @param loopback         Whether multicast datagrams are also delivered to receivers on this host.
+            @return                 True if all options were applied, False if not.
+        */
+        bool setMulticastOptions(unsigned char ttl, unsigned int interfaceAddress, bool loopback)
+        {
+            if (!isOpen())
+                return false;
+
+            bool ok = true;
+
+            if (ipv6)
+            {
+                int hops = ttl;
+                int loop = loopback ? 1 : 0;
+
+                if (ttl != 0)
+                    ok &= setsockopt(handle, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, (const char*)&hops, sizeof(hops)) == 0;
+
+                if (scopeId != 0)
+                    ok &= setsockopt(handle, IPPROTO_IPV6, IPV6_MULTICAST_IF, (const char*)&scopeId, sizeof(scopeId)) == 0;
+
+                ok &= setsockopt(handle, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, (const char*)&loop, sizeof(loop)) == 0;
+
+                // IPv4 multicast through a dual-stack socket is best effort; not every platform allows it
+                if (ttl != 0)
+                {
+                    int value = ttl;
+                    setsockopt(handle, IPPROTO_IP, IP_MULTICAST_TTL, (const char*)&value, sizeof(value));
+                }
+
+                return ok;
+            }
+
+            if (ttl != 0)
+            {
+                int value = ttl;
+                ok &= setsockopt(handle, IPPROTO_IP, IP_MULTICAST_TTL, (const char*)&value, sizeof(value)) == 0;
+            }
+
+            if (interfaceAddress != 0)
+            {
+                in_addr addr;
+                addr.s_addr = htonl(interfaceAddress);
+                ok &= setsockopt(handle, IPPROTO_IP, IP_MULTICAST_IF, (const char*)&addr, sizeof(addr)) == 0;
+            }
+
+            int loop = loopback ? 1 : 0;
+            ok &= setsockopt(handle, IPPROTO_IP, IP_MULTICAST_LOOP, (const char*)&loop, sizeof(loop)) == 0;
+            return ok;
+        }
+
+        /** @brief Allows or forbids sending to broadcast addresses from this socket. The socket must be open.
+            @return                 True if the option was applied, False if not.
+        */
+        bool setBroadcast(bool enabled)
+        {
+            if (!isOpen())
+                return false;
+
+            int value = enabled ? 1 : 0;
+            return setsockopt(handle, SOL_SOCKET, SO_BROADCAST, (const char*)&value, sizeof(value)) == 0;
+        }
+
+        /** @brief Whether a 4 byte IPv4 address is a multicast group address (224.0.0.0 - 239.255.255.255).*/
+        static bool isMulticastAddress(unsigned int address) { return (address >> 28) == 0xE; }
+
+        /** @brief Gets the number of send system calls made since the last reset.*/
+        unsigned long long getNumSyscalls() const { return numSyscalls.load(std::memory_order_relaxed); }
+
+        /** @brief Resets the number of send system calls to 0.*/
+        void resetNumSyscalls() { numSyscalls.store(0, std::memory_order_relaxed); }
+
+        /** @brief Gets the number of receive system calls made since the last reset.*/
+        unsigned long long getNumReceiveSyscalls() const { return numReceiveSyscalls.load(std::memory_order_relaxed); }
+
+        /** @brief Resets the number of receive system calls to 0.*/
+        void resetNumReceiveSyscalls() { numReceiveSyscalls.store(0, std::memory_order_relaxed); }
+
+        /** @brief Converts a 4 byte IPv4 address and port into an IPv4 socket address.*/
+        static sockaddr_in toSockAddr(unsigned int address, unsigned short port)
+        {
+            sockaddr_in addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(address);
+            addr.sin_port = htons(port);
+            return addr;
+        }
+
+    private:
+        static bool isTimeout()
+        {
+#ifdef _WIN32
+            return WSAGetLastError() == WSAETIMEDOUT;
+#else
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+        }
+
+#ifdef _WIN32
+        using SocketHandle = SOCKET;
+        static constexpr SocketHandle invalidHandle = INVALID_SOCKET;
+        bool wsaStarted = false;
+#else
+        using SocketHandle = int;
+        static constexpr SocketHandle invalidHandle = -1;
+#endif
+
+        SocketHandle handle = invalidHandle;
+        bool ipv6 = false;
+        unsigned int scopeId = 0;      // the local interface index of an IPv6 socket
+        std::atomic<unsigned long long> numSyscalls { 0 };
+        std::atomic<unsigned long long> numReceiveSyscalls { 0 };
+    };
+
+} // namespace LsUtils
@@ -0,0 +1,341 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPerfStats.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// The number of samples the jitter buffer of a pacing listener can hold (a power of two)
+#ifndef LS_PACING_QUEUE_SIZE
+#define LS_PACING_QUEUE_SIZE        32
+#endif
+
+//==============================================================================
+/**
+    @brief Counters and frame interval statistics of a @ref LumasonicPacingListener.
+*/
+struct LumasonicPacingStats
+{
+    unsigned long long numReceived;     ///< The number of samples received from the reader.
+    unsigned long long numEmitted;      ///< The number of frames passed to the wrapped listener, including interpolated and repeated ones.
+    unsigned long long numInterpolated; ///< The number of frames interpolated because the jitter buffer was running low.
+    unsigned long long numRepeated;     ///< The number of frames that repeated the previous one because the jitter buffer was empty.
+    unsigned long long numDropped;      ///< The number of samples dropped to keep the latency of the jitter buffer bounded.
+    int queuedSamples;                  ///< The number of samples currently waiting in the jitter buffer.
+    double targetIntervalMs;            ///< The requested time between frames.
+    double meanIntervalMs;              ///< The average achieved time between frames.
+    double minIntervalMs;               ///< The shortest achieved time between frames.
+    double maxIntervalMs;               ///< The longest achieved time between frames.
+    double p99IntervalMs;               ///< The 99th percentile of the achieved time between frames.
+};
+
+//==============================================================================
+/**
+ * @brief A listener that passes @ref StereoColorSample values to another listener
+ * at a fixed cadence, on its own thread, smoothing the bursts in which readers
+ * deliver them.
+ *
+ * @details
+ * Readers dispatch samples as audio buffers are decoded, so when a reader catches
+ * up after a stall its listeners get a burst of samples and then nothing for a
+ * while. Network listeners pass those bursts straight on to the lighting
+ * controllers, which show them as stutter.
+ *
+ * The pacing listener is registered with a reader in place of the listener to
+ * pace. On the reader's thread it only pushes the sample into a small lock-free
+ * jitter buffer. Its own thread wakes once per frame and delivers one frame:
+ *
+ * Jitter buffer        | Frame delivered
+ * ---------------------|-------------------------------------------------------
+ * Two or more samples  | The oldest sample
+ * One sample           | An interpolation halfway from the previous frame to that sample, stretching the buffer until more samples arrive
+ * Empty                | The previous frame again
+ *
+ * Delivery starts once the buffer holds the jitter depth, and waits for it to
+ * fill up again whenever it runs dry, so the buffer can absorb bursts of up to
+ * that many samples. When it grows past twice the depth, the oldest samples are
+ * dropped so the added latency stays bounded. The frame rate defaults to the codec's rate
+ * for the audio settings (`Sample Rate / Audio Buffer Size`), and the achieved
+ * frame intervals are reported by @ref getStats().
+ *
+ * ### Pacing a Listener
+ *
+ * ```c++
+ *
+ * auto* sacnListener = new LumasonicSacnListener();
+ * sacnListener->startSacn(cfg);
+ *
+ * LumasonicPacingListener pacer(sacnListener);
+ * pacer.setFrameRateForAudio(48000., 256);                 // 187.5 frames per second
+ * pacer.setJitterDepth(2);                                 // up to 2 frames of added latency
+ *
+ * lsReader->addListener(&pacer);                           // register the pacer instead of the network listener
+ * pacer.start();
+ *
+ * auto stats = pacer.getStats();                           // stats.p99IntervalMs, stats.numRepeated, ...
+ *
+ * ```
+ *
+ * The @ref LumasonicRunningProcess passed to the wrapped listener is the pacing
+ * listener itself: calling `signalProcessShouldExit()` stops the pacing thread,
+ * not the reader.
+ */
+class LumasonicPacingListener : public LumasonicStereoColorListener, public LumasonicRunningProcess
+{
+public:
+    //==============================================================================
+    /** @brief Constructor
+        @param listener             The listener to deliver paced frames to.
+        @param frameRateHz          The rate at which frames are delivered, in frames per second.
+        @param jitterDepth          The number of samples kept in the jitter buffer before frames are delivered.
+    */
+    explicit LumasonicPacingListener(LumasonicStereoColorListener* listener, double frameRateHz = 48000. / 256., int jitterDepth = 2)
+        : target(listener)
+    {
+        setFrameRate(frameRateHz);
+        setJitterDepth(jitterDepth);
+    }
+
+    /** @brief Destructor.*/
+    ~LumasonicPacingListener() override { stop(); }
+
+    //==============================================================================
+    /** @brief Gets the frame rate of the pacing thread in frames per second. This method is thread-safe/atomic.*/
+    double getFrameRate() const { return frameRate.load(); }
+
+    /** @brief Sets the frame rate of the pacing thread in frames per second. This method is thread-safe/atomic.*/
+    void setFrameRate(double newFrameRateHz) { frameRate.store(newFrameRateHz > 0. ? newFrameRateHz : 48000. / 256.); }
+
+    /** @brief Sets the frame rate to the rate at which the codec produces samples for the given audio settings. This method is thread-safe/atomic.
+        @param sampleRate           The audio sample rate in Hz.
+        @param bufferSize           The audio buffer size in samples.
+    */
+    void setFrameRateForAudio(double sampleRate, int bufferSize)
+    {
+        if (sampleRate > 0. && bufferSize > 0)
+            setFrameRate(sampleRate / bufferSize);
+    }
+
+    /** @brief Gets the number of samples kept in the jitter buffer. This method is thread-safe/atomic.*/
+    int getJitterDepth() const { return jitterDepth.load(); }
+
+    /** @brief Sets the number of samples kept in the jitter buffer, from 1 to half of @ref LS_PACING_QUEUE_SIZE.
+        Each sample adds one frame of latency. This method is thread-safe/atomic.
+    */
+    void setJitterDepth(int newDepth)
+    {
+        jitterDepth.store(newDepth < 1 ? 1 : (newDepth > LS_PACING_QUEUE_SIZE / 2 ? LS_PACING_QUEUE_SIZE / 2 : newDepth));
+    }
+
+    /** @brief Starts the pacing thread.*/
+    void start()
+    {
+        if (running.load())
+            return;
+
+        if (thread.joinable())
+            thread.join();
+
+        running.store(true);
+        thread = std::thread(&LumasonicPacingListener::run, this);
+    }
+
+    /** @brief Stops the pacing thread. Samples still in the jitter buffer are kept for the next start.*/
+    void stop()
+    {
+        running.store(false);
+
+        if (thread.joinable() && thread.get_id() != std::this_thread::get_id())
+            thread.join();
+    }
+
+    /** @brief Whether the pacing thread is currently running. This method is thread-safe.*/
+    bool isRunning() const { return running.load(); }
+
+    /** @brief Called by the wrapped listener to stop the pacing thread.*/
+    void signalProcessShouldExit() override { running.store(false); }
+
+    //==============================================================================
+    /** @brief Gets the counters and the achieved frame interval statistics. This method is thread-safe.*/
+    LumasonicPacingStats getStats() const
+    {
+        LumasonicPacingStats stats {};
+        stats.numReceived = numReceived.load(std::memory_order_relaxed);
+        stats.numEmitted = numEmitted.load(std::memory_order_relaxed);
+        stats.numInterpolated = numInterpolated.load(std::memory_order_relaxed);
+        stats.numRepeated = numRepeated.load(std::memory_order_relaxed);
+        stats.numDropped = numDropped.load(std::memory_order_relaxed);
+        stats.queuedSamples = (int)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+        stats.targetIntervalMs = 1000. / frameRate.load();
+        stats.meanIntervalMs = intervals.getMeanMs();
+        stats.minIntervalMs = intervals.getMinMs();
+        stats.maxIntervalMs = intervals.getMaxMs();
+        stats.p99IntervalMs = intervals.getPercentileMs(99.);
+        return stats;
+    }
+
+    /** @brief Resets the counters and the frame interval statistics.*/
+    void resetStats()
+    {
+        numReceived.store(0, std::memory_order_relaxed);
+        numEmitted.store(0, std::memory_order_relaxed);
+        numInterpolated.store(0, std::memory_order_relaxed);
+        numRepeated.store(0, std::memory_order_relaxed);
+        numDropped.store(0, std::memory_order_relaxed);
+        intervals.reset();
+    }
+
+    //==============================================================================
+    /** @brief Pushes a new sample into the jitter buffer. Called on the reader's thread.
+        @param process              A reference to the running process that called this listener.
+        @param stereoColor          The stereo color sample value that has been read.
+    */
+    void onStereoColorRead(LumasonicRunningProcess& /*process*/, StereoColorSample stereoColor) override
+    {
+        numReceived.fetch_add(1, std::memory_order_relaxed);
+
+        auto h = head.load(std::memory_order_relaxed);
+
+        // The pacing thread keeps the buffer short; if it stalled, the newest samples are the ones dropped
+        if (h - tail.load(std::memory_order_acquire) >= LS_PACING_QUEUE_SIZE)
+        {
+            numDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        queue[h % LS_PACING_QUEUE_SIZE] = stereoColor;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+private:
+    //==============================================================================
+    void run()
+    {
+        auto nextWake = std::chrono::steady_clock::now();
+        uint64_t lastEmitNanos = 0;
+
+        while (running.load())
+        {
+            auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1. / frameRate.load()));
+            nextWake += interval;
+            std::this_thread::sleep_until(nextWake);
+
+            // Keep the cadence through the usual wake-up delays, but don't try to catch up on missed frames after a stall
+            auto now = std::chrono::steady_clock::now();
+            if (now - nextWake > interval)
+                nextWake = now;
+
+            StereoColorSample frame;
+            if (!nextFrame(frame))
+                continue;
+
+            auto emitNanos = LsUtils::monotonicNanos();
+            if (lastEmitNanos != 0)
+                intervals.recordNanos(emitNanos - lastEmitNanos);
+            lastEmitNanos = emitNanos;
+
+            target->onStereoColorRead(*this, frame);
+            numEmitted.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Picks the frame of the current tick from the jitter buffer; false until the first sample is delivered
+    bool nextFrame(StereoColorSample& frame)
+    {
+        int depth = jitterDepth.load();
+        auto t = tail.load(std::memory_order_relaxed);
+        auto queued = (int)(head.load(std::memory_order_acquire) - t);
+
+        if (queued > depth * 2)
+        {
+            numDropped.fetch_add((unsigned long long)(queued - depth), std::memory_order_relaxed);
+            t += (unsigned int)(queued - depth);
+            queued = depth;
+        }
+
+        // Fill up to the full depth at the start and after running dry, so bursts are absorbed again
+        if (!primed && queued >= depth)
+            primed = true;
+
+        if (primed && (queued > 1 || (queued == 1 && depth == 1)))
+        {
+            last = queue[t % LS_PACING_QUEUE_SIZE];
+            tail.store(t + 1, std::memory_order_release);
+            hasLast = true;
+        }
+        else if (!hasLast)
+        {
+            tail.store(t, std::memory_order_release);
+            return false;
+        }
+        else if (queued > 0)
+        {
+            // Running low: stretch toward the next sample instead of using it up
+            last = interpolate(last, queue[t % LS_PACING_QUEUE_SIZE]);
+            tail.store(t, std::memory_order_release);
+            numInterpolated.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            primed = false;
+            numRepeated.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        frame = last;
+        return true;
+    }
+
+    static StereoColorSample interpolate(const StereoColorSample& a, const StereoColorSample& b)
+    {
+        return StereoColorSample(b.ts > a.ts ? a.ts + (b.ts - a.ts) / 2 : a.ts,
+                                 (a.r0 + b.r0) * .5f, (a.g0 + b.g0) * .5f, (a.b0 + b.b0) * .5f,
+                                 (a.r1 + b.r1) * .5f, (a.g1 + b.g1) * .5f, (a.b1 + b.b1) * .5f);
+    }
+
+    //==============================================================================
+    LumasonicStereoColorListener* target;
+    std::atomic<double> frameRate { 48000. / 256. };
+    std::atomic<int> jitterDepth { 2 };
+    std::atomic<bool> running { false };
+
+    StereoColorSample queue[LS_PACING_QUEUE_SIZE];  // single producer (reader), single consumer (pacing thread)
+    std::atomic<unsigned int> head { 0 };
+    std::atomic<unsigned int> tail { 0 };
+    StereoColorSample last;                         // only touched on the pacing thread
+    bool hasLast = false;
+    bool primed = false;
+
+    std::atomic<unsigned long long> numReceived { 0 };
+    std::atomic<unsigned long long> numEmitted { 0 };
+    std::atomic<unsigned long long> numInterpolated { 0 };
+    std::atomic<unsigned long long> numRepeated { 0 };
+    std::atomic<unsigned long long> numDropped { 0 };
+    LsUtils::LatencyHistogram intervals;
+    std::thread thread;
+};
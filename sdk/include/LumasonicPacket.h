@@ -0,0 +1,514 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// The number of bytes of a serialized stereo color sample
+#ifndef LS_STEREO_COLOR_SAMPLE_SIZE
+#define LS_STEREO_COLOR_SAMPLE_SIZE 32
+#endif
+
+// The number of bytes of the v2 packet header
+#define LS_PACKET_V2_HEADER_SIZE    16
+
+// The magic number at the start of a v2 packet ('L' 'S' 'P' '2' in byte order)
+#define LS_PACKET_V2_MAGIC          0x3250534Cu
+
+// The version number carried by v2 packets
+#define LS_PACKET_V2_VERSION        2
+
+// The number of bytes of the base timestamp that follows the v2 header of quantized packets
+#define LS_PACKET_V2_BASE_TS_SIZE   8
+
+// The number of datagrams in a row that must fall behind the sequence window before a stream counts as restarted
+#define LS_SEQUENCE_RESTART_COUNT   8
+
+//==============================================================================
+/**
+    @brief The UDP packet formats the SDK can send and parse.
+
+    @details
+    **Version 1** is the original format of @ref LumasonicStereoUdpListener: a datagram
+    holds one or more 32 byte samples and nothing else.
+
+    **Version 2** starts every datagram with a 16 byte header so receivers can tell
+    streams apart on a shared port and detect lost or reordered datagrams.
+    All header fields are little-endian:
+
+    Bytes| Type                    | Value
+    -----|-------------------------|-----------
+    4    | 32-bit unsigned int     | magic `LSP2` (@ref LS_PACKET_V2_MAGIC)
+    1    | 8-bit unsigned int      | version (2)
+    1    | 8-bit unsigned int      | sample encoding (@ref LumasonicSampleEncodings)
+    2    | 16-bit unsigned int     | number of samples
+    4    | 32-bit unsigned int     | stream ID
+    4    | 32-bit unsigned int     | sequence number, incremented by 1 per datagram of the stream
+
+    With the float encoding the samples follow the header, oldest first, in the 32 byte
+    layout of version 1. With a quantized encoding the header is followed by a 64-bit
+    base timestamp and then the compact samples, each with its timestamp stored as the
+    difference from the base timestamp.
+*/
+enum class LumasonicPacketFormats
+{
+    LS_Packet_V1 = 1,           ///< Bare 32 byte samples (default, compatible with all receivers)
+    LS_Packet_V2 = 2            ///< 16 byte header with stream ID and sequence number, followed by the samples
+};
+
+/**
+    @brief The encodings of the samples of a v2 packet.
+*/
+enum class LumasonicSampleEncodings
+{
+    LS_Encoding_Float32 = 0,    ///< 32 byte samples: 64-bit timestamp and six 32-bit float levels
+    LS_Encoding_U16 = 1,        ///< 16 byte samples: 32-bit timestamp delta and six 16-bit levels (0 - 65535)
+    LS_Encoding_U8 = 2          ///< 8 byte samples: 16-bit timestamp delta and six 8-bit levels (0 - 255)
+};
+
+namespace LsUtils
+{
+    //==============================================================================
+    /** @brief Writes a 16-bit unsigned int in little-endian byte order.*/
+    inline void writeLE16(unsigned char* p, uint16_t v) { p[0] = (unsigned char)v; p[1] = (unsigned char)(v >> 8); }
+
+    /** @brief Writes a 32-bit unsigned int in little-endian byte order.*/
+    inline void writeLE32(unsigned char* p, uint32_t v) { writeLE16(p, (uint16_t)v); writeLE16(p + 2, (uint16_t)(v >> 16)); }
+
+    /** @brief Reads a 16-bit unsigned int in little-endian byte order.*/
+    inline uint16_t readLE16(const unsigned char* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+    /** @brief Reads a 32-bit unsigned int in little-endian byte order.*/
+    inline uint32_t readLE32(const unsigned char* p) { return (uint32_t)readLE16(p) | ((uint32_t)readLE16(p + 2) << 16); }
+
+    /** @brief Writes a 64-bit unsigned int in little-endian byte order.*/
+    inline void writeLE64(unsigned char* p, uint64_t v) { writeLE32(p, (uint32_t)v); writeLE32(p + 4, (uint32_t)(v >> 32)); }
+
+    /** @brief Reads a 64-bit unsigned int in little-endian byte order.*/
+    inline uint64_t readLE64(const unsigned char* p) { return (uint64_t)readLE32(p) | ((uint64_t)readLE32(p + 4) << 32); }
+
+    //==============================================================================
+    /** @brief Gets the number of bytes of one sample in an encoding, or 0 for an unknown encoding.*/
+    inline size_t sampleSizeForEncoding(LumasonicSampleEncodings encoding)
+    {
+        switch (encoding)
+        {
+            case LumasonicSampleEncodings::LS_Encoding_Float32: return LS_STEREO_COLOR_SAMPLE_SIZE;
+            case LumasonicSampleEncodings::LS_Encoding_U16:     return 16;
+            case LumasonicSampleEncodings::LS_Encoding_U8:      return 8;
+            default:                                            return 0;
+        }
+    }
+
+    /** @brief Gets the number of bytes before the first sample of a v2 packet in an encoding.*/
+    inline size_t payloadOffsetForEncoding(LumasonicSampleEncodings encoding)
+    {
+        return LS_PACKET_V2_HEADER_SIZE + (encoding == LumasonicSampleEncodings::LS_Encoding_Float32 ? 0 : LS_PACKET_V2_BASE_TS_SIZE);
+    }
+
+    /** @brief Gets the largest timestamp delta a sample can store in an encoding.*/
+    inline uint64_t maxTimestampDeltaForEncoding(LumasonicSampleEncodings encoding)
+    {
+        switch (encoding)
+        {
+            case LumasonicSampleEncodings::LS_Encoding_U16: return 0xFFFFFFFFull;
+            case LumasonicSampleEncodings::LS_Encoding_U8:  return 0xFFFFull;
+            default:                                        return ~0ull;
+        }
+    }
+
+    /** @brief Quantizes a level from 0 - 1 to an unsigned int from 0 - maxValue, rounding to the nearest step.*/
+    inline uint32_t quantizeLevel(float level, uint32_t maxValue)
+    {
+        if (!(level > 0.f))
+            return 0;
+
+        return level >= 1.f ? maxValue : (uint32_t)(level * (float)maxValue + 0.5f);
+    }
+
+    //==============================================================================
+    /** @brief Serializes a @ref StereoColorSample into the 32 byte UDP payload layout
+        documented in @ref LumasonicStereoUdpListener.
+        @param sample               The sample to serialize.
+        @param data                 The buffer to write to (at least @ref LS_STEREO_COLOR_SAMPLE_SIZE bytes).
+    */
+    inline void stereoColorSampleToData(const StereoColorSample& sample, void* data)
+    {
+        auto* bytes = static_cast<unsigned char*>(data);
+        const float values[6] = { sample.r0, sample.g0, sample.b0, sample.r1, sample.g1, sample.b1 };
+
+        std::memcpy(bytes, &sample.ts, 8);
+        std::memcpy(bytes + 8, values, sizeof(values));
+    }
+
+    /** @brief Deserializes a @ref StereoColorSample from the 32 byte UDP payload layout.
+        Unlike @ref LumasonicStereoUdpListener::stereocolorSampleFromData(), this works on unaligned buffers.
+        @param data                 The buffer to read from (at least @ref LS_STEREO_COLOR_SAMPLE_SIZE bytes).
+        @return                     The deserialized stereo color data. If there was no data, the timestamp will be 0.
+    */
+    inline StereoColorSample stereoColorSampleFromData(const void* data)
+    {
+        auto* bytes = static_cast<const unsigned char*>(data);
+        StereoColorSample sample;
+        float values[6];
+
+        std::memcpy(&sample.ts, bytes, 8);
+        std::memcpy(values, bytes + 8, sizeof(values));
+
+        sample.r0 = values[0]; sample.g0 = values[1]; sample.b0 = values[2];
+        sample.r1 = values[3]; sample.g1 = values[4]; sample.b1 = values[5];
+        return sample;
+    }
+
+    //==============================================================================
+    /** @brief Writes a v2 packet header.
+        @param data                 The buffer to write to (at least @ref LS_PACKET_V2_HEADER_SIZE bytes).
+        @param streamId             The ID of the stream the packet belongs to.
+        @param sequence             The sequence number of the packet within its stream.
+        @param numSamples           The number of samples that follow the header.
+        @param encoding             The encoding of the samples that follow the header.
+    */
+    inline void writePacketHeaderV2(void* data, uint32_t streamId, uint32_t sequence, int numSamples,
+                                    LumasonicSampleEncodings encoding = LumasonicSampleEncodings::LS_Encoding_Float32)
+    {
+        auto* bytes = static_cast<unsigned char*>(data);
+
+        writeLE32(bytes, LS_PACKET_V2_MAGIC);
+        bytes[4] = LS_PACKET_V2_VERSION;
+        bytes[5] = (unsigned char)encoding;
+        writeLE16(bytes + 6, (uint16_t)numSamples);
+        writeLE32(bytes + 8, streamId);
+        writeLE32(bytes + 12, sequence);
+    }
+
+    /** @brief Builds a v2 packet from as many samples as fit.
+        @details
+        Samples are written until the buffer is full or, for quantized encodings, until
+        a timestamp can no longer be stored as a delta from the first sample (it is
+        too far ahead or goes backwards). The rest belong in the next packet.
+        Quantized levels are clamped to 0 - 1.
+        @param data                 The buffer to write to.
+        @param capacity             The size of the buffer in bytes.
+        @param streamId             The ID of the stream the packet belongs to.
+        @param sequence             The sequence number of the packet within its stream.
+        @param samples              The samples to write, oldest first.
+        @param numSamples           The number of samples available.
+        @param encoding             The encoding of the samples in the packet.
+        @param numWritten           Optional, set to the number of samples written.
+        @return                     The number of bytes written, or 0 if not even one sample fits.
+    */
+    inline size_t writePacketV2(void* data, size_t capacity, uint32_t streamId, uint32_t sequence,
+                                const StereoColorSample* samples, int numSamples,
+                                LumasonicSampleEncodings encoding = LumasonicSampleEncodings::LS_Encoding_Float32,
+                                int* numWritten = nullptr)
+    {
+        if (numWritten != nullptr)
+            *numWritten = 0;
+
+        size_t sampleSize = sampleSizeForEncoding(encoding);
+        size_t offset = payloadOffsetForEncoding(encoding);
+
+        if (data == nullptr || samples == nullptr || numSamples <= 0 || sampleSize == 0 || capacity < offset + sampleSize)
+            return 0;
+
+        auto* bytes = static_cast<unsigned char*>(data);
+        auto* out = bytes + offset;
+        auto baseTs = samples[0].ts;
+        auto maxDelta = maxTimestampDeltaForEncoding(encoding);
+
+        int count = (int)((capacity - offset) / sampleSize);
+        count = count < numSamples ? count : numSamples;
+        count = count < 0xFFFF ? count : 0xFFFF;
+
+        int n = 0;
+        for (; n < count; ++n, out += sampleSize)
+        {
+            const auto& sc = samples[n];
+
+            if (encoding == LumasonicSampleEncodings::LS_Encoding_Float32)
+            {
+                stereoColorSampleToData(sc, out);
+                continue;
+            }
+
+            if (sc.ts < baseTs || sc.ts - baseTs > maxDelta)
+                break;
+
+            const float levels[6] = { sc.r0, sc.g0, sc.b0, sc.r1, sc.g1, sc.b1 };
+
+            if (encoding == LumasonicSampleEncodings::LS_Encoding_U16)
+            {
+                writeLE32(out, (uint32_t)(sc.ts - baseTs));
+                for (int c = 0; c < 6; ++c)
+                    writeLE16(out + 4 + c * 2, (uint16_t)quantizeLevel(levels[c], 0xFFFF));
+            }
+            else
+            {
+                writeLE16(out, (uint16_t)(sc.ts - baseTs));
+                for (int c = 0; c < 6; ++c)
+                    out[2 + c] = (unsigned char)quantizeLevel(levels[c], 0xFF);
+            }
+        }
+
+        writePacketHeaderV2(bytes, streamId, sequence, n, encoding);
+
+        if (encoding != LumasonicSampleEncodings::LS_Encoding_Float32)
+            writeLE64(bytes + LS_PACKET_V2_HEADER_SIZE, baseTs);
+
+        if (numWritten != nullptr)
+            *numWritten = n;
+
+        return offset + (size_t)n * sampleSize;
+    }
+
+    //==============================================================================
+    /**
+     * @brief A read-only view of a received UDP datagram in any @ref LumasonicPacketFormats.
+     *
+     * @details
+     * The view does not copy the datagram: it checks the header once and decodes
+     * samples straight from the receive buffer when asked, so the buffer must
+     * outlive the view. Datagrams without the v2 magic are treated as version 1
+     * when their size is a multiple of @ref LS_STEREO_COLOR_SAMPLE_SIZE.
+     *
+     * ```c++
+     *
+     * LsUtils::PacketView packet(buffer, numBytesReceived);
+     *
+     * if (packet.isValid())
+     * {
+     *     lossTracker.update(packet.getSequence());
+     *
+     *     for (int i = 0; i < packet.getNumSamples(); ++i)
+     *         handleSample(packet.getStreamId(), packet.getSample(i));
+     * }
+     *
+     * ```
+     */
+    class PacketView
+    {
+    public:
+        /** @brief Parses the header of a datagram.
+            @param data             The received datagram.
+            @param size             The number of bytes received.
+        */
+        PacketView(const void* data, size_t size)
+            : bytes(static_cast<const unsigned char*>(data))
+        {
+            if (bytes == nullptr)
+                return;
+
+            if (size >= LS_PACKET_V2_HEADER_SIZE && readLE32(bytes) == LS_PACKET_V2_MAGIC)
+            {
+                auto enc = (LumasonicSampleEncodings)bytes[5];
+                size_t encSize = sampleSizeForEncoding(enc);
+                size_t offset = payloadOffsetForEncoding(enc);
+                int count = readLE16(bytes + 6);
+
+                if (bytes[4] != LS_PACKET_V2_VERSION || encSize == 0 || offset + (size_t)count * encSize > size)
+                    return;
+
+                format = LumasonicPacketFormats::LS_Packet_V2;
+                encoding = enc;
+                sampleSize = encSize;
+                numSamples = count;
+                streamId = readLE32(bytes + 8);
+                sequence = readLE32(bytes + 12);
+                baseTs = offset > LS_PACKET_V2_HEADER_SIZE ? readLE64(bytes + LS_PACKET_V2_HEADER_SIZE) : 0;
+                samples = bytes + offset;
+            }
+            else if (size > 0 && size % LS_STEREO_COLOR_SAMPLE_SIZE == 0)
+            {
+                format = LumasonicPacketFormats::LS_Packet_V1;
+                numSamples = (int)(size / LS_STEREO_COLOR_SAMPLE_SIZE);
+                samples = bytes;
+            }
+        }
+
+        /** @brief Whether the datagram holds a complete packet in a known format.*/
+        bool isValid() const { return samples != nullptr; }
+
+        /** @brief Gets the format of the packet. Only meaningful if @ref isValid() is True.*/
+        LumasonicPacketFormats getFormat() const { return format; }
+
+        /** @brief Whether the packet has a stream ID and sequence number (v2 and later).*/
+        bool hasSequence() const { return format != LumasonicPacketFormats::LS_Packet_V1; }
+
+        /** @brief Gets the stream ID of the packet, or 0 for v1 packets.*/
+        uint32_t getStreamId() const { return streamId; }
+
+        /** @brief Gets the sequence number of the packet, or 0 for v1 packets.*/
+        uint32_t getSequence() const { return sequence; }
+
+        /** @brief Gets the encoding of the samples in the packet. v1 packets always use float samples.*/
+        LumasonicSampleEncodings getEncoding() const { return encoding; }
+
+        /** @brief Gets the number of samples in the packet.*/
+        int getNumSamples() const { return numSamples; }
+
+        /** @brief Decodes one sample of the packet.
+            @param index            The index of the sample, from 0 (oldest) to @ref getNumSamples() - 1.
+        */
+        StereoColorSample getSample(int index) const
+        {
+            const auto* p = getSampleData(index);
+
+            switch (encoding)
+            {
+                case LumasonicSampleEncodings::LS_Encoding_U16:
+                {
+                    const float scale = 1.f / 65535.f;
+                    return StereoColorSample(baseTs + readLE32(p),
+                                             readLE16(p + 4) * scale, readLE16(p + 6) * scale, readLE16(p + 8) * scale,
+                                             readLE16(p + 10) * scale, readLE16(p + 12) * scale, readLE16(p + 14) * scale);
+                }
+                case LumasonicSampleEncodings::LS_Encoding_U8:
+                {
+                    const float scale = 1.f / 255.f;
+                    return StereoColorSample(baseTs + readLE16(p),
+                                             p[2] * scale, p[3] * scale, p[4] * scale,
+                                             p[5] * scale, p[6] * scale, p[7] * scale);
+                }
+                case LumasonicSampleEncodings::LS_Encoding_Float32:
+                default:
+                    return stereoColorSampleFromData(p);
+            }
+        }
+
+        /** @brief Gets a pointer to the encoded bytes of one sample inside the receive buffer.*/
+        const unsigned char* getSampleData(int index) const { return samples + (size_t)index * sampleSize; }
+
+    private:
+        const unsigned char* bytes = nullptr;
+        const unsigned char* samples = nullptr;
+        LumasonicPacketFormats format = LumasonicPacketFormats::LS_Packet_V1;
+        LumasonicSampleEncodings encoding = LumasonicSampleEncodings::LS_Encoding_Float32;
+        size_t sampleSize = LS_STEREO_COLOR_SAMPLE_SIZE;
+        unsigned long long baseTs = 0;
+        int numSamples = 0;
+        uint32_t streamId = 0;
+        uint32_t sequence = 0;
+    };
+
+    //==============================================================================
+    /**
+     * @brief Tracks the sequence numbers of one v2 stream to count lost, late and
+     * duplicated datagrams.
+     *
+     * @details
+     * Keeps a 64 datagram window behind the newest sequence number seen. A datagram
+     * that skips ahead counts the gap as lost; when one of those arrives later it is
+     * counted as reordered and no longer as lost. Sequence numbers may wrap around.
+     *
+     * A sender that restarts begins its sequence numbers again, far behind the
+     * window. When @ref LS_SEQUENCE_RESTART_COUNT datagrams in a row fall behind the
+     * window, or one falls behind by half the sequence range or more, the stream
+     * is taken as restarted: the window follows the new numbers and the restart is
+     * counted, while the other counters carry on.
+     */
+    struct SequenceTracker
+    {
+        unsigned long long received = 0;       ///< Datagrams accepted (new sequence numbers)
+        unsigned long long lost = 0;           ///< Datagrams skipped over and not (yet) received
+        unsigned long long reordered = 0;      ///< Datagrams that arrived after a newer one
+        unsigned long long duplicates = 0;     ///< Datagrams received more than once, or too late to tell
+        unsigned long long restarts = 0;       ///< Times the sender started its sequence numbers over
+
+        /** @brief Records a received sequence number.
+            @return                 True if the datagram is new and should be used, False if it is a duplicate or too old.
+        */
+        bool update(uint32_t sequence)
+        {
+            if (!started)
+            {
+                started = true;
+                newest = sequence;
+                window = 1;
+                ++received;
+                return true;
+            }
+
+            // Both distances are computed unsigned so that no wrap-around can overflow
+            uint32_t ahead = sequence - newest;
+            uint32_t behind = newest - sequence;
+
+            if (ahead != 0 && ahead < 0x80000000u)
+            {
+                lost += ahead - 1;
+                window = ahead >= 64 ? 1 : (window << ahead) | 1;
+                newest = sequence;
+                numBehind = 0;
+                ++received;
+                return true;
+            }
+
+            if (behind >= 64)
+            {
+                if (behind < 0x80000000u && ++numBehind < LS_SEQUENCE_RESTART_COUNT)
+                {
+                    ++duplicates;
+                    return false;
+                }
+
+                newest = sequence;
+                window = 1;
+                numBehind = 0;
+                ++restarts;
+                ++received;
+                return true;
+            }
+
+            numBehind = 0;
+
+            if ((window & (1ull << behind)) != 0)
+            {
+                ++duplicates;
+                return false;
+            }
+
+            window |= 1ull << behind;
+            ++reordered;
+            ++received;
+
+            if (lost > 0)
+                --lost;
+
+            return true;
+        }
+
+        /** @brief Forgets the stream so the next sequence number starts it again.*/
+        void reset() { *this = SequenceTracker(); }
+
+    private:
+        bool started = false;
+        uint32_t newest = 0;
+        uint64_t window = 0;
+        int numBehind = 0;
+    };
+
+} // namespace LsUtils
@@ -0,0 +1,514 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Enables or disables per-sample latency trace stamps in readers (zero-cost when disabled).
+#ifndef LS_USE_LATENCY_TRACE
+#define LS_USE_LATENCY_TRACE 0
+#endif
+
+// The number of sub-bucket bits of a latency histogram (exact below 2^bits ns, then 2^(bits - 1) = 32 buckets per power of two, ~1.5% precision)
+#ifndef LS_HISTOGRAM_SUB_BUCKET_BITS
+#define LS_HISTOGRAM_SUB_BUCKET_BITS    6
+#endif
+
+// The highest power of two in nanoseconds a latency histogram can track; larger values are clamped (2^40 ns is ~18 minutes)
+#ifndef LS_HISTOGRAM_MAX_VALUE_BITS
+#define LS_HISTOGRAM_MAX_VALUE_BITS     40
+#endif
+
+namespace LsUtils
+{
+    //==============================================================================
+    /** @brief Gets the current time of the monotonic system clock in nanoseconds.*/
+    inline uint64_t monotonicNanos()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    //==============================================================================
+    /**
+     * @brief A single-writer sequence lock that publishes snapshots of a trivially
+     * copyable value.
+     *
+     * @details
+     * The writing thread never blocks or waits, and reading threads copy the most
+     * recent complete value without taking any lock or consuming from a queue. A
+     * reader only retries if it raced with a write in progress, so polling a
+     * snapshot has no measurable effect on the timing of the writing thread.
+     *
+     * ```c++
+     *
+     * LsUtils::SeqLock<LumasonicReadPerfInfo> published;
+     * published.store(info);                   // writing thread
+     *
+     * LumasonicReadPerfInfo snapshot;
+     * if (published.load(snapshot))            // any other thread
+     *      auto avgMs = snapshot.dataAverageTimeMs;
+     *
+     * ```
+     */
+    template <typename ValueType>
+    class SeqLock
+    {
+    public:
+        static_assert(std::is_trivially_copyable<ValueType>::value, "SeqLock values must be trivially copyable");
+
+        /** @brief Constructor*/
+        SeqLock()
+        {
+            for (auto& w : words)
+                w.store(0, std::memory_order_relaxed);
+        }
+
+        /** @brief Publishes a new value. Only one thread may call this method.*/
+        void store(const ValueType& value)
+        {
+            uint64_t buffer[numWords] = {};
+            std::memcpy(buffer, &value, sizeof(ValueType));
+
+            auto seq = sequence.load(std::memory_order_relaxed);
+            sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (size_t i = 0; i < numWords; ++i)
+                words[i].store(buffer[i], std::memory_order_relaxed);
+
+            sequence.store(seq + 2, std::memory_order_release);
+        }
+
+        /** @brief Copies the most recently published value. This method is thread-safe and lock-free.
+            @param value        The value that will be assigned the published snapshot.
+            @return             True if a value has been published, False if not (the value is left unaltered).
+        */
+        bool load(ValueType& value) const
+        {
+            uint64_t buffer[numWords];
+            uint32_t before, after;
+
+            do
+            {
+                before = sequence.load(std::memory_order_acquire);
+
+                for (size_t i = 0; i < numWords; ++i)
+                    buffer[i] = words[i].load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = sequence.load(std::memory_order_relaxed);
+            }
+            while ((before & 1) != 0 || before != after);
+
+            if (before == 0)
+                return false;
+
+            std::memcpy(&value, buffer, sizeof(ValueType));
+            return true;
+        }
+
+    private:
+        static constexpr size_t numWords = (sizeof(ValueType) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+        std::atomic<uint32_t> sequence { 0 };
+        std::atomic<uint64_t> words[numWords];
+    };
+
+    //==============================================================================
+    /**
+     * @brief Computes the rolling window and session timing values of a
+     * @ref LumasonicReadPerfInfo timing category from a stream of time deltas.
+     *
+     * @details
+     * The rolling window holds the last @ref windowSize deltas. Nothing is allocated
+     * after construction.
+     */
+    class RollingTimingWindow
+    {
+    public:
+        /** @brief The number of time deltas in the rolling window.*/
+        static constexpr int windowSize = 64;
+
+        /** @brief Adds a new time delta in milliseconds.*/
+        void add(double ms)
+        {
+            values[next] = ms;
+            next = (next + 1) % windowSize;
+            count = count < windowSize ? count + 1 : windowSize;
+
+            totalMin = ms < totalMin ? ms : totalMin;
+            totalMax = ms > totalMax ? ms : totalMax;
+
+            currentMin = currentMax = values[0];
+            double sum = 0.;
+
+            for (int i = 0; i < count; ++i)
+            {
+                currentMin = values[i] < currentMin ? values[i] : currentMin;
+                currentMax = values[i] > currentMax ? values[i] : currentMax;
+                sum += values[i];
+            }
+
+            average = sum / count;
+        }
+
+        /** @brief Clears the rolling window and the session values.*/
+        void reset()
+        {
+            next = count = 0;
+            currentMin = currentMax = average = 0.;
+            totalMin = 1e300;
+            totalMax = 0.;
+        }
+
+        double currentMin = 0.;     ///< The shortest delta in the rolling window.
+        double currentMax = 0.;     ///< The longest delta in the rolling window.
+        double average = 0.;        ///< The average delta in the rolling window.
+        double totalMin = 1e300;    ///< The shortest delta since the last reset.
+        double totalMax = 0.;       ///< The longest delta since the last reset.
+
+    private:
+        double values[windowSize] = {};
+        int next = 0;
+        int count = 0;
+    };
+
+    //==============================================================================
+    /**
+     * @brief A fixed size, HDR-style histogram of time intervals.
+     *
+     * @details
+     * Values are recorded in nanoseconds into log-linear buckets: values below 64 ns
+     * are stored exactly, and each power of two above that is split into 32 buckets,
+     * keeping the relative error of any reported value under ~1.5%.
+     *
+     * The histogram never allocates after construction, and recording is a handful
+     * of relaxed atomic operations, so it is safe to record from one or more
+     * timing-sensitive threads while another thread reads percentiles.
+     *
+     * ```c++
+     *
+     * LsUtils::LatencyHistogram hist;
+     * hist.recordNanos(1500000);           // record 1.5 ms
+     * double p99 = hist.getP99Ms();        // 99th percentile in milliseconds
+     * hist.reset();                        // start over
+     *
+     * ```
+     *
+     * > [!NOTE]
+     * > Values read while another thread records are not a single atomic snapshot,
+     * > but are always within one or two samples of one.
+     */
+    class LatencyHistogram
+    {
+    public:
+        /** @brief The number of exactly stored values below the first log-linear bucket.*/
+        static constexpr int numLinearBuckets = 1 << LS_HISTOGRAM_SUB_BUCKET_BITS;
+
+        /** @brief The number of buckets for each power of two above the linear range.*/
+        static constexpr int numSubBuckets = numLinearBuckets / 2;
+
+        /** @brief The total number of buckets in the histogram.*/
+        static constexpr int numBuckets = numLinearBuckets + (LS_HISTOGRAM_MAX_VALUE_BITS - LS_HISTOGRAM_SUB_BUCKET_BITS + 1) * numSubBuckets;
+
+        /** @brief Constructor*/
+        LatencyHistogram() { reset(); }
+
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        /** @brief Records a time interval given in nanoseconds. This method is thread-safe/atomic.*/
+        inline void recordNanos(uint64_t nanos)
+        {
+            counts[bucketIndex(nanos)].fetch_add(1, std::memory_order_relaxed);
+            totalCount.fetch_add(1, std::memory_order_relaxed);
+            totalNanos.fetch_add(nanos, std::memory_order_relaxed);
+
+            auto lo = minNanos.load(std::memory_order_relaxed);
+            while (nanos < lo && !minNanos.compare_exchange_weak(lo, nanos, std::memory_order_relaxed)) {}
+
+            auto hi = maxNanos.load(std::memory_order_relaxed);
+            while (nanos > hi && !maxNanos.compare_exchange_weak(hi, nanos, std::memory_order_relaxed)) {}
+        }
+
+        /** @brief Records a time interval given in milliseconds. This method is thread-safe/atomic.*/
+        inline void recordMs(double ms) { recordNanos(ms > 0 ? (uint64_t)(ms * 1000000.) : 0); }
+
+        /** @brief Clears all recorded values. This method is thread-safe.*/
+        void reset()
+        {
+            for (auto& c : counts)
+                c.store(0, std::memory_order_relaxed);
+
+            totalCount.store(0, std::memory_order_relaxed);
+            totalNanos.store(0, std::memory_order_relaxed);
+            minNanos.store(UINT64_MAX, std::memory_order_relaxed);
+            maxNanos.store(0, std::memory_order_relaxed);
+        }
+
+        /** @brief Gets the number of values recorded since the last reset.*/
+        uint64_t getCount() const { return totalCount.load(std::memory_order_relaxed); }
+
+        /** @brief Gets the lowest value recorded (in milliseconds), or 0 if none were recorded.*/
+        double getMinMs() const
+        {
+            auto lo = minNanos.load(std::memory_order_relaxed);
+            return lo == UINT64_MAX ? 0. : (double)lo / 1000000.;
+        }
+
+        /** @brief Gets the highest value recorded (in milliseconds).*/
+        double getMaxMs() const { return (double)maxNanos.load(std::memory_order_relaxed) / 1000000.; }
+
+        /** @brief Gets the mean of all values recorded (in milliseconds), or 0 if none were recorded.*/
+        double getMeanMs() const
+        {
+            auto count = getCount();
+            return count == 0 ? 0. : (double)totalNanos.load(std::memory_order_relaxed) / (double)count / 1000000.;
+        }
+
+        /** @brief Gets the value at a given percentile of all recorded values.
+            @param percentile       The percentile to get (0.0 - 100.0).
+            @return                 The value at the percentile in milliseconds, or 0 if no values were recorded.
+        */
+        double getPercentileMs(double percentile) const
+        {
+            auto count = getCount();
+
+            if (count == 0)
+                return 0.;
+
+            if (percentile < 0.)   percentile = 0.;
+            if (percentile > 100.) percentile = 100.;
+
+            // The rank of the value to find, counting from 1
+            auto rank = (uint64_t)std::ceil(percentile / 100. * (double)count);
+            rank = rank < 1 ? 1 : rank;
+
+            uint64_t seen = 0;
+
+            for (int i = 0; i < numBuckets; ++i)
+            {
+                seen += counts[i].load(std::memory_order_relaxed);
+
+                if (seen >= rank)
+                {
+                    // Report the middle of the bucket, clamped to the values actually seen
+                    double value = (double)(bucketLowest(i) + bucketHighest(i)) / 2.;
+                    double ms = value / 1000000.;
+                    return ms < getMinMs() ? getMinMs() : (ms > getMaxMs() ? getMaxMs() : ms);
+                }
+            }
+
+            return getMaxMs();
+        }
+
+        /** @brief Gets the median value (in milliseconds).*/
+        double getP50Ms() const { return getPercentileMs(50.); }
+
+        /** @brief Gets the 90th percentile value (in milliseconds).*/
+        double getP90Ms() const { return getPercentileMs(90.); }
+
+        /** @brief Gets the 99th percentile value (in milliseconds).*/
+        double getP99Ms() const { return getPercentileMs(99.); }
+
+        /** @brief Gets the 99.9th percentile value (in milliseconds).*/
+        double getP999Ms() const { return getPercentileMs(99.9); }
+
+        /** @brief Gets the bucket a value in nanoseconds is counted in.*/
+        static int bucketIndex(uint64_t nanos)
+        {
+            if (nanos < (uint64_t)numLinearBuckets)
+                return (int)nanos;
+
+            if (nanos >> (LS_HISTOGRAM_MAX_VALUE_BITS + 1))
+                return numBuckets - 1;
+
+            int msb = 63;
+            while ((nanos >> msb) == 0)
+                --msb;
+
+            int shift = msb - LS_HISTOGRAM_SUB_BUCKET_BITS + 1;
+            int sub = (int)(nanos >> shift) - numSubBuckets;
+            return numLinearBuckets + (shift - 1) * numSubBuckets + sub;
+        }
+
+        /** @brief Gets the lowest value in nanoseconds counted in a bucket.*/
+        static uint64_t bucketLowest(int index)
+        {
+            if (index < numLinearBuckets)
+                return (uint64_t)index;
+
+            int shift = (index - numLinearBuckets) / numSubBuckets + 1;
+            int sub = (index - numLinearBuckets) % numSubBuckets + numSubBuckets;
+            return (uint64_t)sub << shift;
+        }
+
+        /** @brief Gets the highest value in nanoseconds counted in a bucket.*/
+        static uint64_t bucketHighest(int index)
+        {
+            return index + 1 < numBuckets ? bucketLowest(index + 1) - 1 : bucketLowest(index);
+        }
+
+    private:
+        std::atomic<uint64_t> counts[numBuckets];
+        std::atomic<uint64_t> totalCount;
+        std::atomic<uint64_t> totalNanos;
+        std::atomic<uint64_t> minNanos;
+        std::atomic<uint64_t> maxNanos;
+    };
+
+} // namespace LsUtils
+
+//==============================================================================
+/**
+ * @brief Monotonic clock stamps (in nanoseconds) of a single @ref StereoColorSample
+ * as it moves from the audio thread to a listener.
+ *
+ * @details
+ * Stamps are only taken when the SDK is compiled with `LS_USE_LATENCY_TRACE=1`.
+ *
+ * Stage    | Stamped when
+ * ---------|------------
+ * notify   | the decoder last signaled new data from the audio thread, before the sample was popped
+ * dequeue  | the reader pops the sample from the decoder
+ * dispatch | the reader calls a listener with the sample
+ * complete | the listener returns (for UDP listeners, the packet has been sent)
+ *
+ * The decoder fills its output buffer inside the library and does not stamp each
+ * sample, so the first stage is the time of the decoder's most recent notification.
+ * When several samples are waiting, all of them carry that newest notification, so
+ * the notify stages measure the time since the last notification rather than how long
+ * each sample waited in the decoder's buffer, and they read low under backlog.
+ *
+ * While a listener is being called, the trace of the sample it receives can be
+ * read with `LsUtils::currentSampleTrace()`.
+ */
+struct LumasonicSampleTrace
+{
+    uint64_t notifyNanos;       ///< When the decoder last signaled new data before the sample was popped, or 0 if unknown.
+    uint64_t dequeueNanos;      ///< When the reader popped the sample from the decoder.
+    uint64_t dispatchNanos;     ///< When the reader started calling the current listener.
+    uint64_t completeNanos;     ///< When the current listener returned.
+};
+
+namespace LsUtils
+{
+    /** @brief Gets the trace of the sample currently being dispatched on the calling thread.
+        @return                 A pointer to the trace, or null when tracing is disabled or no sample is being dispatched.
+    */
+    inline LumasonicSampleTrace*& currentSampleTrace()
+    {
+        static thread_local LumasonicSampleTrace* trace = nullptr;
+        return trace;
+    }
+
+} // namespace LsUtils
+
+//==============================================================================
+/**
+ * @brief Tail latency and jitter histograms of a reader.
+ *
+ * @details
+ * Where @ref LumasonicReadPerfInfo reports rolling min/max/average values,
+ * these histograms keep the whole distribution of each timing category so
+ * percentiles like p99 and p99.9 can be used to decide when a station is
+ * misbehaving.
+ *
+ * Name     | Description
+ * ---------|------------
+ * thread   | the delta time between wake-ups of the reader's thread
+ * data     | the delta time between continuous decoded data availability (per decoder)
+ * latency  | the time from the decoder signaling new data to the listeners being called
+ *
+ * ```c++
+ *
+ * auto& hist = lsMultiReader->getPerfHistograms();
+ * auto p99DataMs = hist.data.getP99Ms();
+ * auto p999LatencyMs = hist.latency.getP999Ms();
+ * hist.reset();
+ *
+ * ```
+ */
+struct LumasonicReadPerfHistograms
+{
+    LsUtils::LatencyHistogram thread;   ///< Delta time between reader thread wake-ups.
+    LsUtils::LatencyHistogram data;     ///< Delta time between decoded data availability.
+    LsUtils::LatencyHistogram latency;  ///< Time from the decoder's data notification to the listener dispatch.
+
+    /** @brief Clears all three histograms. This method is thread-safe.*/
+    void reset()
+    {
+        thread.reset();
+        data.reset();
+        latency.reset();
+    }
+};
+
+//==============================================================================
+/**
+ * @brief Per-stage latency histograms built from @ref LumasonicSampleTrace stamps.
+ *
+ * Name     | Description
+ * ---------|------------
+ * sinceNotify | last notify to dequeue: time since the decoder last signaled new data
+ * dispatch    | dequeue to dispatch: time spent before the listener was called
+ * send        | dispatch to complete: time spent inside the listener
+ * total       | last notify to complete: audio thread to wire, for the newest waiting sample
+ *
+ * See @ref LumasonicSampleTrace for why the notify stages are not per-sample queue times.
+ */
+struct LumasonicTraceHistograms
+{
+    LsUtils::LatencyHistogram sinceNotify;  ///< Last notify to dequeue.
+    LsUtils::LatencyHistogram dispatch;     ///< Dequeue to listener dispatch.
+    LsUtils::LatencyHistogram send;         ///< Listener dispatch to completion.
+    LsUtils::LatencyHistogram total;        ///< Last notify to listener completion.
+
+    /** @brief Records the listener stages of a completed trace. This method is thread-safe/atomic.*/
+    void recordListener(const LumasonicSampleTrace& trace)
+    {
+        dispatch.recordNanos(trace.dispatchNanos - trace.dequeueNanos);
+        send.recordNanos(trace.completeNanos - trace.dispatchNanos);
+
+        if (trace.notifyNanos != 0)
+            total.recordNanos(trace.completeNanos - trace.notifyNanos);
+    }
+
+    /** @brief Clears all four histograms. This method is thread-safe.*/
+    void reset()
+    {
+        sinceNotify.reset();
+        dispatch.reset();
+        send.reset();
+        total.reset();
+    }
+};
@@ -0,0 +1,296 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPixelMap.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define LS_PIXEL_EFFECTS_SSE 1
+#endif
+
+namespace LsUtils
+{
+    //==============================================================================
+    /**
+     * @brief Turns a stream of @ref StereoColorSample values into per-pixel frames
+     * for the LED bars of a @ref PixelMapConfig, applying its @ref LumasonicPixelEffects
+     * update mode and frame decay.
+     *
+     * @details
+     * The engine keeps one RGB float frame buffer, laid out bar by bar so each
+     * output owns a contiguous block of pixels. All buffers are sized by
+     * @ref configure(); @ref process() never allocates, so it can run on the
+     * reader's thread. The result is encoded with @ref PixelMapper::render(const float*, unsigned char*, size_t) const.
+     *
+     * Fill modes move one pixel per frame. With @ref LumasonicLedBarLayouts::LS_Layout_1x2 each half of
+     * the bar fills on its own, so the left and right channels keep their sides.
+     *
+     * ```c++
+     *
+     * LsUtils::PixelMapper mapper;
+     * LsUtils::PixelEffectEngine effects;
+     *
+     * pixelMap.effect = LumasonicPixelEffects::LS_Effect_Ping_Pong_Fill;
+     * pixelMap.frameDecay = .25f;         // lit pixels fade out over 250 ms
+     *
+     * mapper.configure(pixelMap);
+     * effects.configure(mapper.getConfig());
+     *
+     * // For each frame
+     * effects.process(sample, 1. / 200.);
+     * mapper.render(effects.getFrame(), universes, LS_DMX_UNIVERSE_SIZE);
+     *
+     * ```
+     */
+    class PixelEffectEngine
+    {
+    public:
+        /** @brief Constructor. Starts with a single 1x1 bar of 0 pixels.*/
+        PixelEffectEngine() { configure(PixelMapConfig {}); }
+
+        /** @brief Sets the layout, pixel count, outputs, effect and decay. The frame is kept
+            if the number of pixels did not change, and cleared to black otherwise.
+            @param newConfig        The pixel map configuration, as clamped by @ref PixelMapper::configure().
+        */
+        void configure(const PixelMapConfig& newConfig)
+        {
+            config = newConfig;
+
+            int numBars = 1;
+            switch (config.layout)
+            {
+                case LumasonicLedBarLayouts::LS_Layout_2x1:     numBars = 2; break;
+                case LumasonicLedBarLayouts::LS_Layout_2x2:
+                case LumasonicLedBarLayouts::LS_Layout_4x1:     numBars = 4; break;
+                default:                                        break;
+            }
+
+            if (config.pixelsPerBar < 0)
+                config.pixelsPerBar = 0;
+
+            if (config.frameDecay < 0.f)
+                config.frameDecay = 0.f;
+
+            // A fill runs over a whole bar, or over each half of a split bar
+            numSegments = 0;
+            for (int bar = 0; bar < numBars; ++bar)
+            {
+                int split = config.layout == LumasonicLedBarLayouts::LS_Layout_1x2 ? config.pixelsPerBar / 2 : config.pixelsPerBar;
+
+                addSegment(bar, bar * config.pixelsPerBar, split, false);
+                addSegment(bar, bar * config.pixelsPerBar + split, config.pixelsPerBar - split, true);
+            }
+
+            int pixels = numBars * config.pixelsPerBar;
+            if (pixels != numPixels)
+            {
+                numPixels = pixels;
+                frame.assign((size_t)numPixels * 3, 0.f);
+                target.assign((size_t)numPixels * 3, 0.f);
+            }
+        }
+
+        /** @brief Gets the configuration in use.*/
+        const PixelMapConfig& getConfig() const { return config; }
+
+        /** @brief Whether the effect changes the output compared to rendering each sample directly
+            with @ref PixelMapper::render(const StereoColorSample&, unsigned char*, size_t) const.
+        */
+        bool isActive() const
+        {
+            return config.effect != LumasonicPixelEffects::LS_Effect_Stereo_Color || config.frameDecay > 0.f;
+        }
+
+        /** @brief Gets the total number of pixels of the frame.*/
+        int getNumPixels() const { return numPixels; }
+
+        /** @brief Gets the current frame: one RGB triplet (0 - 1) per pixel, numbered bar by bar.*/
+        const float* getFrame() const { return frame.data(); }
+
+        /** @brief Sets every pixel of the frame to black and restarts the fills.*/
+        void clear()
+        {
+            std::fill(frame.begin(), frame.end(), 0.f);
+
+            for (int s = 0; s < numSegments; ++s)
+            {
+                segments[s].backward = false;
+                segments[s].frameCount = 0;
+            }
+        }
+
+        //==============================================================================
+        /** @brief Advances the effect by one frame showing a new sample.
+            @param sample           The stereo color sample entering the bars.
+            @param elapsedSeconds   The time since the previous frame, used by the frame decay.
+        */
+        void process(const StereoColorSample& sample, double elapsedSeconds)
+        {
+            float step = 1.f;
+            if (config.frameDecay > 0.f)
+                step = elapsedSeconds > 0. ? (float)(elapsedSeconds / config.frameDecay) : 0.f;
+
+            float* pixels = frame.data();
+
+            if (config.effect == LumasonicPixelEffects::LS_Effect_Stereo_Color || config.effect > LumasonicPixelEffects::LS_Effect_Ping_Pong_Fill)
+            {
+                // Every pixel shows the sample; decay lets pixels that got darker fade out instead of dropping
+                float* colors = target.data();
+
+                for (int s = 0; s < numSegments; ++s)
+                {
+                    float c[3];
+                    segmentColor(sample, segments[s], c);
+
+                    for (int i = 0; i < segments[s].count; ++i)
+                        std::memcpy(colors + (segments[s].first + i) * 3, c, sizeof(c));
+                }
+
+                fade(pixels, colors, (size_t)numPixels * 3, step);
+                return;
+            }
+
+            if (config.frameDecay > 0.f)
+                fade(pixels, nullptr, (size_t)numPixels * 3, step);
+
+            for (int s = 0; s < numSegments; ++s)
+            {
+                auto& segment = segments[s];
+                float* first = pixels + segment.first * 3;
+                size_t moved = (size_t)(segment.count - 1) * 3 * sizeof(float);
+
+                bool backward = config.effect == LumasonicPixelEffects::LS_Effect_Backward_Fill
+                             || (config.effect == LumasonicPixelEffects::LS_Effect_Ping_Pong_Fill && segment.backward);
+
+                // Push the pixels one step along the bar, then the new color enters at the free end
+                float* head = first;
+                if (backward)
+                {
+                    std::memmove(first, first + 3, moved);
+                    head = first + (segment.count - 1) * 3;
+                }
+                else
+                {
+                    std::memmove(first + 3, first, moved);
+                }
+
+                segmentColor(sample, segment, head);
+
+                if (++segment.frameCount >= segment.count)
+                {
+                    segment.frameCount = 0;
+                    segment.backward = !segment.backward;
+                }
+            }
+        }
+
+    private:
+        //==============================================================================
+        struct Segment
+        {
+            int bar;
+            int first;
+            int count;
+            bool second;        // the second half of a split bar
+            bool backward;      // ping pong direction
+            int frameCount;     // frames since the ping pong direction last changed
+        };
+
+        void addSegment(int bar, int first, int count, bool second)
+        {
+            if (count <= 0)
+                return;
+
+            auto& segment = segments[numSegments++];
+            bool sameShape = segment.bar == bar && segment.first == first && segment.count == count;
+
+            segment.bar = bar;
+            segment.first = first;
+            segment.count = count;
+            segment.second = second;
+
+            if (!sameShape)
+            {
+                segment.backward = false;
+                segment.frameCount = 0;
+            }
+        }
+
+        void segmentColor(const StereoColorSample& sample, const Segment& segment, float* rgb) const
+        {
+            float first[3], second[3];
+            PixelMapper::getBarColors(config, sample, segment.bar, first, second);
+            std::memcpy(rgb, segment.second ? second : first, sizeof(first));
+        }
+
+        // pixels = max(colors, pixels - step), clamped at 0; without colors the pixels only fade
+        static void fade(float* pixels, const float* colors, size_t count, float step)
+        {
+            size_t i = 0;
+
+#if LS_PIXEL_EFFECTS_SSE
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 s = _mm_set1_ps(step);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 v = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(pixels + i), s), zero);
+
+                if (colors != nullptr)
+                    v = _mm_max_ps(v, _mm_loadu_ps(colors + i));
+
+                _mm_storeu_ps(pixels + i, v);
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                float v = pixels[i] - step;
+                v = v > 0.f ? v : 0.f;
+
+                if (colors != nullptr && colors[i] > v)
+                    v = colors[i];
+
+                pixels[i] = v;
+            }
+        }
+
+        //==============================================================================
+        PixelMapConfig config {};
+        int numPixels = -1;
+        std::vector<float> frame;       // the current frame, one contiguous block per output
+        std::vector<float> target;      // the colors of the current sample, for the stereo color mode
+
+        Segment segments[LS_PIXEL_NUM_OUTPUTS * 2] {};
+        int numSegments = 0;
+    };
+
+} // namespace LsUtils
@@ -0,0 +1,262 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicNet.h"
+#include "LumasonicPerfStats.h"
+#include "LumasonicPixelEffects.h"
+#include "LumasonicPixelMap.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+//==============================================================================
+/**
+ * @brief Base class of the listeners that drive LED pixel bars over a DMX
+ * over IP protocol (@ref LumasonicSacnListener, @ref LumasonicArtNetListener).
+ *
+ * @details
+ * The base class owns the socket, the @ref LsUtils::PixelMapper, the
+ * @ref LsUtils::PixelEffectEngine and one preallocated packet per universe. For
+ * each sample it runs the update mode, renders the DMX data straight into the
+ * packets and asks the protocol to send the frame, so the dispatch path never
+ * allocates. Protocols only build their packet headers and
+ * send the frame.
+ */
+class LumasonicPixelListener : public LumasonicStereoColorListener
+{
+public:
+    //==============================================================================
+    /** @brief Destructor.*/
+    ~LumasonicPixelListener() override = default;
+
+    //==============================================================================
+    /** @brief The unique ID of the instance.*/
+    int id = -1;
+
+    /** @brief Whether the socket is currently bound and open.*/
+    bool isSocketOpen()
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        return socket.isOpen();
+    }
+
+    /** @brief Changes the settings of one output (enabled, dimmer, invert) without restarting the stream.
+        @param outputIndex          The index of the output, from 0 (A) to @ref LS_PIXEL_NUM_OUTPUTS - 1 (D).
+        @param output               The new output settings.
+    */
+    void setOutput(int outputIndex, PixelOutputConfig output)
+    {
+        if (outputIndex < 0 || outputIndex >= LS_PIXEL_NUM_OUTPUTS)
+            return;
+
+        std::lock_guard<std::mutex> sl(lock);
+
+        auto pixelMap = mapper.getConfig();
+        pixelMap.outputs[outputIndex] = output;
+        mapper.configure(pixelMap);
+        effects.configure(mapper.getConfig());
+    }
+
+    /** @brief Changes the pixel update mode and frame decay without restarting the stream.
+        @param effect               How samples are drawn onto the pixels.
+        @param frameDecay           The time in seconds a pixel takes to fade to black once it is no longer lit, or 0 to disable decay.
+    */
+    void setEffect(LumasonicPixelEffects effect, float frameDecay)
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        auto pixelMap = mapper.getConfig();
+        pixelMap.effect = effect;
+        pixelMap.frameDecay = frameDecay;
+        mapper.configure(pixelMap);
+        effects.configure(mapper.getConfig());
+    }
+
+    //==============================================================================
+    /** @brief Gets the first universe sent.*/
+    int getStartUniverse() const
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        return startUniverse;
+    }
+
+    /** @brief Gets the last universe sent, calculated from the start universe and the pixel map.*/
+    int getEndUniverse() const
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        return startUniverse + mapper.getNumUniverses() - 1;
+    }
+
+    /** @brief Gets the last channel used in the last universe.*/
+    int getEndChannel() const
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        return mapper.getEndChannel();
+    }
+
+    /** @brief Gets the number of universes sent per frame.*/
+    int getNumUniverses() const
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        return mapper.getNumUniverses();
+    }
+
+    /** @brief Gets the total number of packets sent. Use @ref resetNumPacketsSent() to reset this counter.*/
+    unsigned long long getNumPacketsSent() const { return numPacketsSent.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the total number of frames (samples rendered to every universe) sent.*/
+    unsigned long long getNumFramesSent() const { return numFramesSent.load(std::memory_order_relaxed); }
+
+    /** @brief Resets the number of packets and frames sent to 0.*/
+    void resetNumPacketsSent()
+    {
+        numPacketsSent.store(0, std::memory_order_relaxed);
+        numFramesSent.store(0, std::memory_order_relaxed);
+    }
+
+    /** @brief Gets the total number of send system calls made.*/
+    unsigned long long getNumSyscalls() const { return socket.getNumSyscalls(); }
+
+    //==============================================================================
+    /** @brief This method is called when the reader's thread has new color data available.
+        @param process              A reference to the running process that called this listener.
+        @param stereoColor          The stereo color sample value that has been read.
+    */
+    void onStereoColorRead(LumasonicRunningProcess& /*process*/, StereoColorSample stereoColor) override
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        if (!streaming || !socket.isOpen())
+            return;
+
+        bool animated = effects.isActive();
+        unsigned long long now = minFrameNanos != 0 || animated ? LsUtils::monotonicNanos() : 0;
+
+        if (minFrameNanos != 0)
+        {
+            if (lastFrameNanos != 0 && now - lastFrameNanos < minFrameNanos)
+                return;
+
+            lastFrameNanos = now;
+        }
+
+        if (animated)
+        {
+            // Fills advance one pixel per frame sent, so they run after the frame rate limit
+            effects.process(stereoColor, lastEffectNanos != 0 ? (double)(now - lastEffectNanos) * 1e-9 : 0.);
+            lastEffectNanos = now;
+            mapper.render(effects.getFrame(), packets.data() + headerSize, packetStride);
+        }
+        else
+        {
+            mapper.render(stereoColor, packets.data() + headerSize, packetStride);
+        }
+
+        sendFrame();
+        numFramesSent.fetch_add(1, std::memory_order_relaxed);
+    }
+
+protected:
+    //==============================================================================
+    /** @brief Constructor
+        @param dmxDataOffset        The byte offset of the DMX data (channel 1) in the protocol's packets.
+        @param maxPacketSize        The size of the protocol's packet carrying a full universe.
+    */
+    LumasonicPixelListener(size_t dmxDataOffset, size_t maxPacketSize)
+        : headerSize(dmxDataOffset), packetStride(maxPacketSize),
+          packets(LS_PIXEL_MAX_UNIVERSES * maxPacketSize, 0)
+    {
+    }
+
+    /** @brief Sends the packets of every universe of the current frame. Called with the lock held.*/
+    virtual void sendFrame() = 0;
+
+    /** @brief Applies the settings shared by all protocols and clears the packets. Called with the lock held.
+        @param pixelMap             How samples are mapped onto pixels and universes.
+        @param firstUniverse        The requested first universe.
+        @param minUniverse          The lowest universe number of the protocol.
+        @param maxUniverse          The highest universe number of the protocol.
+        @param frameRateLimit       The maximum number of frames sent per second, or 0 for no limit.
+    */
+    void configureStream(const PixelMapConfig& pixelMap, int firstUniverse, int minUniverse, int maxUniverse, double frameRateLimit)
+    {
+        mapper.configure(pixelMap);
+        effects.configure(mapper.getConfig());
+        effects.clear();
+        lastEffectNanos = 0;
+
+        int numUniverses = mapper.getNumUniverses();
+        startUniverse = firstUniverse < minUniverse ? minUniverse : firstUniverse;
+        if (startUniverse + numUniverses - 1 > maxUniverse)
+            startUniverse = maxUniverse - numUniverses + 1;
+
+        minFrameNanos = frameRateLimit > 0. ? (unsigned long long)(1e9 / frameRateLimit) : 0;
+        lastFrameNanos = 0;
+
+        std::fill(packets.begin(), packets.end(), (unsigned char)0);
+    }
+
+    /** @brief Gets the packet of a universe.
+        @param universeIndex        The index of the universe, from 0 to the number of universes - 1.
+    */
+    unsigned char* packet(int universeIndex) { return packets.data() + (size_t)universeIndex * packetStride; }
+
+    /** @brief Sends a batch of packets and counts the ones sent. Called with the lock held.*/
+    void sendPackets(const LsUtils::UdpMessage* messages, int count)
+    {
+        int sent = socket.sendBatch(messages, count);
+        numPacketsSent.fetch_add((unsigned long long)sent, std::memory_order_relaxed);
+    }
+
+    /** @brief Writes a 16-bit unsigned int in big-endian (network) byte order.*/
+    static void writeBE16(unsigned char* p, unsigned short v) { p[0] = (unsigned char)(v >> 8); p[1] = (unsigned char)v; }
+
+    /** @brief Writes a 32-bit unsigned int in big-endian (network) byte order.*/
+    static void writeBE32(unsigned char* p, unsigned int v) { writeBE16(p, (unsigned short)(v >> 16)); writeBE16(p + 2, (unsigned short)v); }
+
+    //==============================================================================
+    mutable std::mutex lock;
+    LsUtils::UdpSocket socket;
+    LsUtils::PixelMapper mapper;
+    LsUtils::PixelEffectEngine effects;
+    bool streaming = false;
+    int startUniverse = 1;
+
+private:
+    //==============================================================================
+    const size_t headerSize;
+    const size_t packetStride;
+    std::vector<unsigned char> packets;     // one packet per universe, allocated once
+    unsigned long long minFrameNanos = 0;
+    unsigned long long lastFrameNanos = 0;
+    unsigned long long lastEffectNanos = 0;
+
+    std::atomic<unsigned long long> numPacketsSent { 0 };
+    std::atomic<unsigned long long> numFramesSent { 0 };
+};
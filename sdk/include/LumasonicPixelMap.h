@@ -0,0 +1,281 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include <cstddef>
+#include <cstring>
+
+// The number of channels (slots) of a DMX universe
+#define LS_DMX_UNIVERSE_SIZE        512
+
+namespace LsUtils
+{
+    //==============================================================================
+    /**
+     * @brief Maps @ref StereoColorSample values onto the pixels of LED bars and
+     * encodes them into DMX universe buffers, as described by a @ref PixelMapConfig.
+     *
+     * @details
+     * The mapper is shared by the pixel listeners (sACN, Art-Net). It does all its
+     * sizing in @ref configure(), so @ref render() only writes bytes into buffers
+     * owned by the caller and never allocates.
+     *
+     * Universe buffers are laid out at a fixed stride, so a listener can render
+     * straight into the DMX data area of its preallocated packets:
+     *
+     * ```c++
+     *
+     * LsUtils::PixelMapper mapper;
+     * mapper.configure(pixelMap);
+     *
+     * // packets holds one 638 byte E1.31 packet per universe, with DMX data at byte 126
+     * mapper.render(sample, packets + 126, 638);
+     *
+     * ```
+     */
+    class PixelMapper
+    {
+    public:
+        /** @brief Constructor. Starts with a single 1x1 bar of 0 pixels.*/
+        PixelMapper() { configure(PixelMapConfig {}); }
+
+        /** @brief Sets the layout, pixel count, encoding and outputs. Out of range values are clamped,
+            and the pixels per bar are reduced if the bars would need more than @ref LS_PIXEL_MAX_UNIVERSES universes.
+        */
+        void configure(const PixelMapConfig& newConfig)
+        {
+            config = newConfig;
+
+            switch (config.encoding)
+            {
+                case LumasonicPixelEncodings::LS_Pixel_RGBW8:   bytesPerPixel = 4; break;
+                case LumasonicPixelEncodings::LS_Pixel_RGB16:   bytesPerPixel = 6; break;
+                case LumasonicPixelEncodings::LS_Pixel_RGB8:
+                default:                                        bytesPerPixel = 3; config.encoding = LumasonicPixelEncodings::LS_Pixel_RGB8; break;
+            }
+
+            switch (config.layout)
+            {
+                case LumasonicLedBarLayouts::LS_Layout_2x1:     numBars = 2; break;
+                case LumasonicLedBarLayouts::LS_Layout_2x2:
+                case LumasonicLedBarLayouts::LS_Layout_4x1:     numBars = 4; break;
+                case LumasonicLedBarLayouts::LS_Layout_1x2:
+                case LumasonicLedBarLayouts::LS_Layout_1x1:
+                default:                                        numBars = 1; break;
+            }
+
+            pixelsPerUniverse = LS_DMX_UNIVERSE_SIZE / bytesPerPixel;
+
+            int maxPixelsPerBar = LS_PIXEL_MAX_UNIVERSES * pixelsPerUniverse / numBars;
+            config.pixelsPerBar = config.pixelsPerBar < 0 ? 0 : (config.pixelsPerBar > maxPixelsPerBar ? maxPixelsPerBar : config.pixelsPerBar);
+
+            for (auto& output : config.outputs)
+                output.dimmer = output.dimmer < 0.f ? 0.f : (output.dimmer > 1.f ? 1.f : output.dimmer);
+
+            numPixels = numBars * config.pixelsPerBar;
+            numUniverses = (numPixels + pixelsPerUniverse - 1) / pixelsPerUniverse;
+        }
+
+        /** @brief Gets the configuration in use, after clamping.*/
+        const PixelMapConfig& getConfig() const { return config; }
+
+        /** @brief Gets the number of LED bars (outputs) used by the layout.*/
+        int getNumBars() const { return numBars; }
+
+        /** @brief Gets the total number of pixels across all bars.*/
+        int getNumPixels() const { return numPixels; }
+
+        /** @brief Gets the number of DMX channels of one pixel.*/
+        int getBytesPerPixel() const { return bytesPerPixel; }
+
+        /** @brief Gets the number of whole pixels that fit in one universe.*/
+        int getPixelsPerUniverse() const { return pixelsPerUniverse; }
+
+        /** @brief Gets the number of universes needed for all pixels.*/
+        int getNumUniverses() const { return numUniverses; }
+
+        /** @brief Gets the number of channels used in a universe.
+            @param universeIndex    The index of the universe, from 0 to @ref getNumUniverses() - 1.
+        */
+        int getNumChannels(int universeIndex) const
+        {
+            if (universeIndex < 0 || universeIndex >= numUniverses)
+                return 0;
+
+            int pixels = numPixels - universeIndex * pixelsPerUniverse;
+            return (pixels < pixelsPerUniverse ? pixels : pixelsPerUniverse) * bytesPerPixel;
+        }
+
+        /** @brief Gets the channel (1 - 512) of the last channel used in the last universe, or 0 if no pixels are mapped.*/
+        int getEndChannel() const { return getNumChannels(numUniverses - 1); }
+
+        //==============================================================================
+        /** @brief Renders a sample onto every pixel (the `Stereo Color` update mode) and encodes it.
+            @param sample           The stereo color sample to show.
+            @param universes        The DMX data of the first universe; channel 1 is at byte 0.
+            @param stride           The number of bytes from one universe's DMX data to the next.
+        */
+        void render(const StereoColorSample& sample, unsigned char* universes, size_t stride) const
+        {
+            for (int bar = 0; bar < numBars; ++bar)
+            {
+                // Each bar shows at most two colors; encode them once and copy them to every pixel
+                float firstColor[3], secondColor[3];
+                int split = getBarColors(config, sample, bar, firstColor, secondColor);
+
+                unsigned char first[8], second[8];
+                encodePixel(firstColor, bar, first);
+                encodePixel(secondColor, bar, second);
+
+                int pixel = bar * config.pixelsPerBar;
+
+                for (int i = 0; i < config.pixelsPerBar; ++i, ++pixel)
+                    std::memcpy(pixelData(universes, stride, pixel), i < split ? first : second, (size_t)bytesPerPixel);
+            }
+        }
+
+        /** @brief Encodes a frame holding one color per pixel, such as the output of a @ref PixelEffectEngine.
+            @param pixels           @ref getNumPixels() RGB triplets (0 - 1), numbered bar by bar.
+            @param universes        The DMX data of the first universe; channel 1 is at byte 0.
+            @param stride           The number of bytes from one universe's DMX data to the next.
+        */
+        void render(const float* pixels, unsigned char* universes, size_t stride) const
+        {
+            int pixel = 0;
+
+            for (int bar = 0; bar < numBars; ++bar)
+                for (int i = 0; i < config.pixelsPerBar; ++i, ++pixel)
+                    encodePixel(pixels + pixel * 3, bar, pixelData(universes, stride, pixel));
+        }
+
+        /** @brief Gets the colors a sample shows on one bar, after the layout and the output's invert setting.
+            @param config           The pixel map configuration.
+            @param sample           The stereo color sample to show.
+            @param bar              The index of the bar, from 0 (A) to @ref LS_PIXEL_NUM_OUTPUTS - 1 (D).
+            @param first            Receives the RGB color of the pixels before the split.
+            @param second           Receives the RGB color of the pixels from the split on.
+            @return                 The index of the first pixel showing the second color.
+        */
+        static int getBarColors(const PixelMapConfig& config, const StereoColorSample& sample, int bar, float* first, float* second)
+        {
+            const float left[3] = { sample.r0, sample.g0, sample.b0 };
+            const float right[3] = { sample.r1, sample.g1, sample.b1 };
+            const float mono[3] = { (sample.r0 + sample.r1) * .5f, (sample.g0 + sample.g1) * .5f, (sample.b0 + sample.b1) * .5f };
+
+            const float* firstColor = mono;
+            const float* secondColor = mono;
+            int split = config.pixelsPerBar;
+
+            switch (config.layout)
+            {
+                case LumasonicLedBarLayouts::LS_Layout_1x2: firstColor = left; secondColor = right; split = config.pixelsPerBar / 2; break;
+                case LumasonicLedBarLayouts::LS_Layout_2x1: firstColor = secondColor = (bar == 0 ? left : right); break;
+                case LumasonicLedBarLayouts::LS_Layout_2x2: firstColor = secondColor = (bar < 2 ? left : right); break;
+                default: break;
+            }
+
+            if (config.outputs[bar].invert)
+            {
+                firstColor = swapSide(firstColor, left, right);
+                secondColor = swapSide(secondColor, left, right);
+            }
+
+            std::memcpy(first, firstColor, sizeof(float) * 3);
+            std::memcpy(second, secondColor, sizeof(float) * 3);
+            return split;
+        }
+
+        /** @brief Sets the DMX data of every used universe to 0 (blackout).*/
+        void clear(unsigned char* universes, size_t stride) const
+        {
+            for (int u = 0; u < numUniverses; ++u)
+                std::memset(universes + u * stride, 0, LS_DMX_UNIVERSE_SIZE);
+        }
+
+    private:
+        //==============================================================================
+        static const float* swapSide(const float* color, const float* left, const float* right)
+        {
+            return color == left ? right : (color == right ? left : color);
+        }
+
+        unsigned char* pixelData(unsigned char* universes, size_t stride, int pixel) const
+        {
+            return universes + (size_t)(pixel / pixelsPerUniverse) * stride + (size_t)(pixel % pixelsPerUniverse) * bytesPerPixel;
+        }
+
+        void encodePixel(const float* rgb, int bar, unsigned char* out) const
+        {
+            const auto& output = config.outputs[bar];
+            float gain = output.enabled ? output.dimmer : 0.f;
+            float c[3];
+
+            for (int i = 0; i < 3; ++i)
+            {
+                float v = rgb[i] * gain;
+                c[i] = v > 0.f ? (v < 1.f ? v : 1.f) : 0.f;
+            }
+
+            switch (config.encoding)
+            {
+                case LumasonicPixelEncodings::LS_Pixel_RGBW8:
+                {
+                    float w = c[0] < c[1] ? (c[0] < c[2] ? c[0] : c[2]) : (c[1] < c[2] ? c[1] : c[2]);
+                    for (int i = 0; i < 3; ++i)
+                        out[i] = (unsigned char)((c[i] - w) * 255.f + .5f);
+                    out[3] = (unsigned char)(w * 255.f + .5f);
+                    break;
+                }
+                case LumasonicPixelEncodings::LS_Pixel_RGB16:
+                {
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        auto v = (unsigned int)(c[i] * 65535.f + .5f);
+                        out[i * 2] = (unsigned char)(v >> 8);
+                        out[i * 2 + 1] = (unsigned char)v;
+                    }
+                    break;
+                }
+                case LumasonicPixelEncodings::LS_Pixel_RGB8:
+                default:
+                {
+                    for (int i = 0; i < 3; ++i)
+                        out[i] = (unsigned char)(c[i] * 255.f + .5f);
+                    break;
+                }
+            }
+        }
+
+        //==============================================================================
+        PixelMapConfig config {};
+        int bytesPerPixel = 3;
+        int numBars = 1;
+        int numPixels = 0;
+        int pixelsPerUniverse = LS_DMX_UNIVERSE_SIZE / 3;
+        int numUniverses = 0;
+    };
+
+} // namespace LsUtils
@@ -0,0 +1,291 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicPixelListener.h"
+#include <cstring>
+#include <mutex>
+#include <random>
+
+// The number of bytes of an E1.31 data packet before the DMX data (including the start code)
+#define LS_SACN_HEADER_SIZE         126
+
+// The number of bytes of an E1.31 data packet carrying a full universe
+#define LS_SACN_PACKET_SIZE         (LS_SACN_HEADER_SIZE + LS_DMX_UNIVERSE_SIZE)
+
+//==============================================================================
+/**
+ * @brief Listener class that drives LED pixel bars over sACN (ANSI E1.31), such
+ * as the Lumasonic Lighting Controller MK1, from decoded @ref StereoColorSample values.
+ *
+ * @details
+ * This is the SDK counterpart of the sACN module of the Prism plug-ins. Each
+ * sample is mapped onto the pixels of the configured LED bar layout (see
+ * @ref PixelMapConfig), encoded as RGB 8-bit, RGBW 8-bit or RGB 16-bit, and sent
+ * as one E1.31 data packet per universe, starting at the configured start universe.
+ *
+ * All packets are preallocated by @ref startSacn(); on the reader's thread the
+ * listener only writes the DMX data and sequence numbers in place and hands all
+ * universes of the frame to the network stack in one batched call.
+ *
+ * > [!NOTE]
+ * > Values are sent on the reader's thread. The listener will not send anything
+ * > until you start it using @ref startSacn(const SacnListenerConfig&).
+ *
+ * ### Configuring the Listener
+ *
+ * ```c++
+ *
+ * auto* sacnListener = new LumasonicSacnListener();
+ *
+ * SacnListenerConfig cfg {};
+ * cfg.localAddress = LumasonicStereoUdpListener::ipv4AddressFromStr("192.168.1.10");   // local interface
+ * cfg.remoteAddress = LumasonicStereoUdpListener::ipv4AddressFromStr("192.168.1.50");  // controller, or 0 for multicast
+ * cfg.startUniverse = 1;
+ * cfg.priority = 100;
+ * strcpy(cfg.sourceName, "Lumasonic");
+ *
+ * cfg.pixelMap.layout = LumasonicLedBarLayouts::LS_Layout_2x1;
+ * cfg.pixelMap.pixelsPerBar = 144;
+ * cfg.pixelMap.encoding = LumasonicPixelEncodings::LS_Pixel_RGB16;
+ *
+ * for (auto& output : cfg.pixelMap.outputs)
+ *     output = { true, 1.f, false };                   // enabled, full brightness, not inverted
+ *
+ * cfg.pixelMap.effect = LumasonicPixelEffects::LS_Effect_Forward_Fill;
+ * cfg.pixelMap.frameDecay = .5f;                       // pixels fade out over 500 ms
+ *
+ * sacnListener->startSacn(cfg);
+ * lsReader->addListener(sacnListener);
+ *
+ * int endUniverse = sacnListener->getEndUniverse();    // 2 bars x 144 RGB16 pixels = 4 universes
+ *
+ * ```
+ *
+ * The output, universe and packet counter methods are inherited from @ref LumasonicPixelListener.
+ *
+ * ### Component Identifier
+ *
+ * E1.31 identifies each source by a 16-byte component identifier (CID) that
+ * receivers expect to stay the same across restarts. Every listener draws a
+ * random one when it is constructed; to keep it, store the bytes from
+ * @ref getCid() and pass them to @ref setCid() the next time.
+ *
+ * ```c++
+ *
+ * unsigned char cid[16];
+ * sacnListener->getCid(cid);                           // save with the host's settings
+ *
+ * // Next session
+ * sacnListener->setCid(savedCid);
+ *
+ * ```
+ *
+ * ### Stopping
+ *
+ * @ref stopSacn() sends the E1.31 stream termination packets so receivers
+ * release the universes immediately instead of waiting for a timeout.
+ */
+class LumasonicSacnListener : public LumasonicPixelListener
+{
+public:
+    //==============================================================================
+    /** @brief Constructor*/
+    LumasonicSacnListener()
+        : LumasonicPixelListener(LS_SACN_HEADER_SIZE, LS_SACN_PACKET_SIZE)
+    {
+        // Every source needs a unique component identifier (a UUID); a new one is drawn
+        // per instance, so hosts that want it to persist save and restore it with setCid()
+        std::random_device rd;
+        for (int i = 0; i < 16; i += 4)
+        {
+            auto r = rd();
+            std::memcpy(cid + i, &r, 4);
+        }
+
+        cid[6] = (unsigned char)((cid[6] & 0x0F) | 0x40);   // version 4
+        cid[8] = (unsigned char)((cid[8] & 0x3F) | 0x80);   // RFC 4122 variant
+    }
+
+    /** @brief Destructor. Stops the stream if it is running.*/
+    ~LumasonicSacnListener() override { stopSacn(); }
+
+    //==============================================================================
+    /** @brief Configures the network and pixel settings and opens the socket. Any running stream is stopped first.
+        @param config               The sACN configuration to use for sending.
+        @return                     True if starting sACN succeeded, False if it failed.
+    */
+    bool startSacn(const SacnListenerConfig& config)
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        terminateStream();
+        socket.close();
+
+        configureStream(config.pixelMap, config.startUniverse, 1, 63999, config.frameRateLimit);
+
+        priority = config.priority > 200 ? 200 : config.priority;
+        remoteAddress = config.remoteAddress;
+        remotePort = config.remotePort != 0 ? config.remotePort : (unsigned short)LS_SACN_PORT;
+
+        std::memset(sourceName, 0, sizeof(sourceName));
+        std::strncpy(sourceName, config.sourceName, LS_SACN_SOURCE_NAME_SIZE - 1);
+
+        for (int u = 0; u < mapper.getNumUniverses(); ++u)
+            buildPacket(u);
+
+        if (!socket.open(config.localAddress, 0, false))
+            return false;
+
+        if (remoteAddress == 0 && !socket.setMulticastOptions(0, config.localAddress, true))
+        {
+            socket.close();
+            return false;
+        }
+
+        streaming = true;
+        return true;
+    }
+
+    /** @brief Sends the stream termination packets, then releases the socket.*/
+    void stopSacn()
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        terminateStream();
+        socket.close();
+    }
+
+    //==============================================================================
+    /** @brief Sets the component identifier sent in every packet. Takes effect immediately, also while streaming.
+        @param newCid               The 16 bytes of the identifier, as returned by @ref getCid().
+    */
+    void setCid(const unsigned char* newCid)
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        std::memcpy(cid, newCid, sizeof(cid));
+
+        for (int u = 0; u < mapper.getNumUniverses(); ++u)
+            std::memcpy(packet(u) + 22, cid, sizeof(cid));
+    }
+
+    /** @brief Gets the component identifier sent in every packet.
+        @param cidOut               A buffer of 16 bytes that receives the identifier.
+    */
+    void getCid(unsigned char* cidOut) const
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        std::memcpy(cidOut, cid, sizeof(cid));
+    }
+
+protected:
+    //==============================================================================
+    void sendFrame() override
+    {
+        int numUniverses = mapper.getNumUniverses();
+
+        for (int u = 0; u < numUniverses; ++u)
+        {
+            packet(u)[111] = sequence[u]++;
+            messages[u] = { packet(u), packetSizes[u], destinations[u], remotePort };
+        }
+
+        sendPackets(messages, numUniverses);
+    }
+
+private:
+    //==============================================================================
+    // Fills in the parts of a universe's packet that don't change from frame to frame
+    void buildPacket(int universeIndex)
+    {
+        auto* p = packet(universeIndex);
+        int slots = mapper.getNumChannels(universeIndex);
+        int universe = startUniverse + universeIndex;
+        packetSizes[universeIndex] = (size_t)(LS_SACN_HEADER_SIZE + slots);
+
+        static const unsigned char acnId[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+
+        // Root layer
+        writeBE16(p + 0, 0x0010);
+        std::memcpy(p + 4, acnId, sizeof(acnId));
+        writeBE16(p + 16, (unsigned short)(0x7000 | (packetSizes[universeIndex] - 16)));
+        writeBE32(p + 18, 0x00000004);
+        std::memcpy(p + 22, cid, 16);
+
+        // Framing layer
+        writeBE16(p + 38, (unsigned short)(0x7000 | (packetSizes[universeIndex] - 38)));
+        writeBE32(p + 40, 0x00000002);
+        std::memcpy(p + 44, sourceName, LS_SACN_SOURCE_NAME_SIZE);
+        p[108] = priority;
+        writeBE16(p + 113, (unsigned short)universe);
+
+        // DMP layer
+        writeBE16(p + 115, (unsigned short)(0x7000 | (packetSizes[universeIndex] - 115)));
+        p[117] = 0x02;
+        p[118] = 0xA1;
+        writeBE16(p + 121, 0x0001);
+        writeBE16(p + 123, (unsigned short)(slots + 1));
+
+        // Receivers of the standard multicast group listen on 239.255.<universe high>.<universe low>
+        destinations[universeIndex] = remoteAddress != 0 ? remoteAddress : (0xEFFF0000u | (unsigned int)universe);
+    }
+
+    // E1.31 asks sources to send 3 packets with the Stream_Terminated option when they stop
+    void terminateStream()
+    {
+        if (!streaming || !socket.isOpen())
+        {
+            streaming = false;
+            return;
+        }
+
+        int numUniverses = mapper.getNumUniverses();
+
+        for (int u = 0; u < numUniverses; ++u)
+            packet(u)[112] |= 0x40;
+
+        for (int i = 0; i < 3; ++i)
+            sendFrame();
+
+        for (int u = 0; u < numUniverses; ++u)
+            packet(u)[112] &= (unsigned char)~0x40;
+
+        streaming = false;
+    }
+
+    //==============================================================================
+    unsigned char cid[16];
+    char sourceName[LS_SACN_SOURCE_NAME_SIZE] {};
+    unsigned char priority = 100;
+    unsigned int remoteAddress = 0;
+    unsigned short remotePort = LS_SACN_PORT;
+
+    size_t packetSizes[LS_PIXEL_MAX_UNIVERSES] {};
+    unsigned int destinations[LS_PIXEL_MAX_UNIVERSES] {};
+    unsigned char sequence[LS_PIXEL_MAX_UNIVERSES] {};
+    LsUtils::UdpMessage messages[LS_PIXEL_MAX_UNIVERSES];
+};
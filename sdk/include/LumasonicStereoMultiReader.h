@@ -0,0 +1,809 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicStereoDecoder.h"
+#include "LumasonicPerfStats.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+//==============================================================================
+/**
+ * @brief A threaded @ref StereoColorSample reader that services many
+ * @ref LumasonicStereoDecoder instances from a single thread (or a small fixed
+ * pool of threads).
+ *
+ * @details
+ * A @ref LumasonicStereoReader reads exactly one decoder, so running 16 streams
+ * means running 16 reader threads. The multi-reader instead polls the output
+ * buffers of every registered decoder from the same thread, and dispatches each
+ * decoded sample to the listeners registered for that decoder.
+ *
+ * The number of threads used is fixed when the multi-reader is created and does
+ * not grow with the number of decoders. New decoders are assigned to the thread
+ * currently servicing the fewest decoders.
+ *
+ * > [!NOTE]
+ * > Just like the @ref LumasonicStereoReader, decoded data is consumed from the
+ * > audio thread in a **lock-free** & **wait-free** manner. The internal locks
+ * > of the multi-reader are only shared between the reading thread and the
+ * > threads that add or remove decoders and listeners.
+ *
+ * ### Creating a Multi-Reader Instance
+ *
+ * ```c++
+ *
+ * auto* lsMultiReader = new LumasonicStereoMultiReader();     // one reading thread for all decoders
+ * auto* lsPoolReader = new LumasonicStereoMultiReader(2);     // two reading threads shared by all decoders
+ *
+ * ```
+ *
+ * ### Adding Decoders
+ *
+ * Unlike the @ref LumasonicStereoReader, the multi-reader connects itself to
+ * each decoder it is given, so there is no need to call
+ * `LumasonicStereoDecoder::setReader()`.
+ *
+ * ```c++
+ *
+ * lsMultiReader->addDecoder(lsDecoderA);
+ * lsMultiReader->addDecoder(lsDecoderB);
+ * lsMultiReader->setThreadMode(LumasonicThreadModes::LS_Thread_Event);
+ * lsMultiReader->start();
+ *
+ * ```
+ *
+ * In the event-driven thread mode, the reading thread only visits the decoders
+ * that have signaled new data, instead of polling every decoder in turn.
+ *
+ * ### Per-Decoder Listeners
+ *
+ * Each decoder has its own set of listeners. A listener can be registered with
+ * more than one decoder.
+ *
+ * ```c++
+ *
+ * lsMultiReader->addListener(lsDecoderA, &udpListenerA);
+ * lsMultiReader->addListener(lsDecoderB, &udpListenerB);
+ * lsMultiReader->removeListener(lsDecoderB, &udpListenerB);
+ *
+ * ```
+ *
+ * Listeners may add and remove listeners, or remove decoders, from within their
+ * callbacks. An edit to a decoder serviced by the calling thread takes effect
+ * right away. Any other edit is queued and applied once the calling thread has
+ * finished dispatching its current samples, and reports success: waiting for
+ * another reading thread from a callback could deadlock if one of its listeners
+ * was waiting for this thread in turn.
+ *
+ * ### Performance Histograms
+ *
+ * The multi-reader records the thread wake interval, the data interval of each
+ * decoder, and the latency from each decoder's data notification to its listeners
+ * into @ref LumasonicReadPerfHistograms, which can be read from any thread.
+ *
+ * ```c++
+ *
+ * auto& hist = lsMultiReader->getPerfHistograms();
+ * auto p99LatencyMs = hist.latency.getP99Ms();
+ * lsMultiReader->resetPerfHistograms();
+ *
+ * ```
+ *
+ * ### Performance Snapshots
+ *
+ * The multi-reader also publishes the values of a @ref LumasonicReadPerfInfo
+ * through a sequence lock every time it reads. Monitoring threads can copy the
+ * latest values as often as they like without locking or draining a queue.
+ *
+ * ```c++
+ *
+ * LumasonicReadPerfInfo info {};
+ *
+ * if (lsMultiReader->getPerfSnapshot(info))
+ *      auto avgDataTimeMs = info.dataAverageTimeMs;
+ *
+ * ```
+ *
+ * ### Latency Tracing
+ *
+ * When compiled with `LS_USE_LATENCY_TRACE=1`, every sample carries the time of
+ * the decoder's latest notification and is stamped when it is dequeued,
+ * dispatched and when each listener returns, and the
+ * stage times are collected into @ref LumasonicTraceHistograms. With the flag
+ * off (the default), none of this code is compiled.
+ *
+ * ```c++
+ *
+ * auto& trace = lsMultiReader->getTraceHistograms();
+ * auto p99AudioToWireMs = trace.total.getP99Ms();
+ *
+ * ```
+ *
+ * ### Deleting a Multi-Reader
+ *
+ * ```c++
+ *
+ * lsMultiReader->stop();                   // first, stop the reading threads
+ * lsMultiReader->clearDecoders();          // next, disconnect all decoders and their listeners
+ * delete lsMultiReader;
+ *
+ * ```
+ *
+ * > [!NOTE]
+ * > A decoder should not be processing audio while it is being removed from the
+ * > multi-reader, and multi-reader instances should be deleted before the decoder
+ * > instances they read from.
+ */
+class LumasonicStereoMultiReader : public LumasonicWaitingProcess, public LumasonicRunningProcess
+{
+public:
+    //==============================================================================
+    /** @brief Constructor
+        @param numThreads           The fixed number of reading threads used to service all decoders (at least 1).
+    */
+    explicit LumasonicStereoMultiReader(int numThreads = 1)
+    {
+        numThreads = (std::max)(1, numThreads);
+
+        for (int i = 0; i < numThreads; ++i)
+            workers.emplace_back(new Worker(*this));
+    }
+
+    /** @brief Destructor.*/
+    virtual ~LumasonicStereoMultiReader()
+    {
+        stop();
+        clearDecoders();
+    }
+
+    //==============================================================================
+    /** @brief The unique ID of the instance.*/
+    int id = -1;
+
+    /** @brief Gets the current reading thread mode. This method is thread-safe/atomic.
+        @return                     The current thread mode enumeration value.
+    */
+    LumasonicThreadModes getThreadMode() { return threadMode.load(); }
+
+    /** @brief Sets the current reading thread mode. This method is thread-safe/atomic.
+        See @ref LumasonicStereoReader::setThreadMode() for a description of each mode.
+        @param newMode              The new thread mode to use for reading.
+    */
+    void setThreadMode(LumasonicThreadModes newMode)
+    {
+        threadMode.store(newMode);
+        notify();
+    }
+
+    /** @brief Gets the number of reading threads used by the instance.*/
+    int getNumThreads() const { return (int)workers.size(); }
+
+    /** @brief Adds a decoder to read from, and connects the multi-reader to it. This method is thread-safe,
+        but unlike the other methods it must not be called from a listener callback.
+        @param decoder              A pointer to the decoder instance to read from.
+        @return                     True if the decoder was added, False if it was null or already added.
+    */
+    bool addDecoder(LumasonicStereoDecoder* decoder)
+    {
+        if (decoder == nullptr)
+            return false;
+
+        Worker* target = workers.front().get();
+
+        {
+            // Held across the duplicate check and the insert, so two concurrent calls can't both add the decoder
+            std::lock_guard<std::mutex> registry(registryLock);
+
+            if (owners.count(decoder) != 0)
+                return false;
+
+            // Assign the decoder to the least busy reading thread
+            for (auto& w : workers)
+                if (w->numSlots.load() < target->numSlots.load())
+                    target = w.get();
+
+            owners[decoder] = target;
+        }
+
+        auto slot = std::make_shared<Slot>(*target, decoder);
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(target->lock);
+            target->slots.push_back(slot);
+            target->numSlots.store((int)target->slots.size());
+        }
+
+        decoder->setReader(slot.get());
+        return true;
+    }
+
+    /** @brief Removes a decoder and all of its listeners, and disconnects the decoder from the multi-reader. This method is thread-safe.
+        @param decoder              A pointer to the decoder instance to remove.
+        @return                     True if the decoder was removed, False if it was not found.
+    */
+    bool removeDecoder(LumasonicStereoDecoder* decoder)
+    {
+        auto* w = findWorker(decoder);
+
+        if (w == nullptr)
+            return false;
+
+        if (deferEdit(w, [this, decoder] { removeDecoder(decoder); }))
+            return true;
+
+        std::lock_guard<std::recursive_mutex> lock(w->lock);
+
+        for (size_t i = 0; i < w->slots.size(); ++i)
+        {
+            if (w->slots[i]->decoder == decoder)
+            {
+                decoder->setReader(nullptr);
+                w->slots[i]->removed = true;
+                w->slots.erase(w->slots.begin() + (std::ptrdiff_t)i);
+                w->numSlots.store((int)w->slots.size());
+                unregisterDecoder(decoder);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** @brief Removes all decoders and their listeners. This method is thread-safe.*/
+    void clearDecoders()
+    {
+        if (deferEdit(nullptr, [this] { clearDecoders(); }))
+            return;
+
+        for (auto& w : workers)
+        {
+            std::lock_guard<std::recursive_mutex> lock(w->lock);
+
+            for (auto& slot : w->slots)
+            {
+                slot->decoder->setReader(nullptr);
+                slot->removed = true;
+                unregisterDecoder(slot->decoder);
+            }
+
+            w->slots.clear();
+            w->numSlots.store(0);
+        }
+    }
+
+    /** @brief Gets the number of decoders currently being read. This method is thread-safe.*/
+    int getNumDecoders()
+    {
+        int count = 0;
+
+        for (auto& w : workers)
+            count += w->numSlots.load();
+
+        return count;
+    }
+
+    /** @brief Adds a listener to be notified when a decoder has a new stereo color sample ready. This method is thread-safe.
+        @param decoder              The decoder whose samples the listener should receive.
+        @param listener             The instance of a @ref LumasonicStereoColorListener to register for events.
+        @return                     True if the listener was added, False if the decoder was not found or the listener was already added.
+    */
+    bool addListener(LumasonicStereoDecoder* decoder, LumasonicStereoColorListener* listener)
+    {
+        return editSlot(decoder, [listener](Slot& slot)
+        {
+            auto& l = slot.listeners;
+
+            if (listener == nullptr || std::find(l.begin(), l.end(), listener) != l.end())
+                return false;
+
+            l.push_back(listener);
+            return true;
+        });
+    }
+
+    /** @brief Removes an existing listener from a decoder's notifications. This method is thread-safe.
+        @param decoder              The decoder the listener was registered with.
+        @param listener             The instance of a @ref LumasonicStereoColorListener to unregister from events.
+        @return                     True if the listener was removed, False if it was not found.
+    */
+    bool removeListener(LumasonicStereoDecoder* decoder, LumasonicStereoColorListener* listener)
+    {
+        return editSlot(decoder, [listener](Slot& slot)
+        {
+            auto& l = slot.listeners;
+            auto it = std::find(l.begin(), l.end(), listener);
+
+            if (it == l.end())
+                return false;
+
+            l.erase(it);
+            return true;
+        });
+    }
+
+    /** @brief Clears the listener list of a single decoder. This method is thread-safe.
+        @param decoder              The decoder to clear the listeners of.
+    */
+    void clearListeners(LumasonicStereoDecoder* decoder)
+    {
+        editSlot(decoder, [](Slot& slot) { slot.listeners.clear(); return true; });
+    }
+
+    /** @brief Clears the listener lists of all decoders. This method is thread-safe.*/
+    void clearListeners()
+    {
+        if (deferEdit(nullptr, [this] { clearListeners(); }))
+            return;
+
+        for (auto& w : workers)
+        {
+            std::lock_guard<std::recursive_mutex> lock(w->lock);
+
+            for (auto& slot : w->slots)
+                slot->listeners.clear();
+        }
+    }
+
+    /** @brief Wakes all reading threads and has them check every decoder for new data.
+        Decoders added with @ref addDecoder() notify the multi-reader on their own, so
+        this method does not need to be called by the producer thread.
+    */
+    void notify() override
+    {
+        for (auto& w : workers)
+        {
+            w->sweep.store(true, std::memory_order_release);
+            w->wake(threadMode.load(std::memory_order_relaxed));
+        }
+    }
+
+    /** @brief Called by registered [listeners](@ref LumasonicStereoColorListener) to indicate
+        that the multi-reader should stop.
+
+        Calling this will stop all reading threads. This means that the listeners of
+        every decoder will stop receiving data until the multi-reader is restarted.
+    */
+    void signalProcessShouldExit() override
+    {
+        running.store(false);
+        notify();
+    }
+
+    /** @brief Starts the reading threads.*/
+    void start()
+    {
+        if (running.load())
+            return;
+
+        // Threads may have exited on their own after a signalProcessShouldExit() call
+        joinWorkers();
+        running.store(true);
+
+        for (auto& w : workers)
+            w->thread = std::thread(&Worker::run, w.get());
+    }
+
+    /** @brief Stops the reading threads.*/
+    void stop()
+    {
+        running.store(false);
+
+        for (auto& w : workers)
+        {
+            std::lock_guard<std::mutex> lock(w->waitLock);
+            w->waitCond.notify_all();
+        }
+
+        joinWorkers();
+    }
+
+    /** @brief Whether the multi-reader is currently running. This method is thread-safe.
+        @return                     True if the multi-reader is currently running/reading, False if not.
+    */
+    bool isRunning() { return running.load(); }
+
+    /** @brief Gets the tail latency and jitter histograms of the multi-reader. The histograms can be read from any thread.*/
+    LumasonicReadPerfHistograms& getPerfHistograms() { return perfHistograms; }
+
+    /** @brief Clears the performance histograms. This method is thread-safe.*/
+    void resetPerfHistograms() { perfHistograms.reset(); }
+
+    /** @brief Copies the most recently published performance information. This method is thread-safe and lock-free.
+
+        With more than one reading thread, the snapshots of each thread are combined:
+        minimums and maximums are taken across threads, and averages are averaged.
+
+        @param info                 The performance information reference that will have its values assigned.
+        @return                     True if performance information has been published, False if not.
+    */
+    bool getPerfSnapshot(LumasonicReadPerfInfo& info) const
+    {
+        LumasonicReadPerfInfo merged {}, next {};
+        int count = 0;
+
+        for (auto& w : workers)
+        {
+            if (!w->perfSnapshot.load(next))
+                continue;
+
+            if (count++ == 0)
+            {
+                merged = next;
+                continue;
+            }
+
+            merged.threadCurrentMinTimeMs = (std::min)(merged.threadCurrentMinTimeMs, next.threadCurrentMinTimeMs);
+            merged.threadCurrentMaxTimeMs = (std::max)(merged.threadCurrentMaxTimeMs, next.threadCurrentMaxTimeMs);
+            merged.threadAverageTimeMs += next.threadAverageTimeMs;
+            merged.threadTotalMinTimeMs = (std::min)(merged.threadTotalMinTimeMs, next.threadTotalMinTimeMs);
+            merged.threadTotalMaxTimeMs = (std::max)(merged.threadTotalMaxTimeMs, next.threadTotalMaxTimeMs);
+            merged.dataCurrentMinTimeMs = (std::min)(merged.dataCurrentMinTimeMs, next.dataCurrentMinTimeMs);
+            merged.dataCurrentMaxTimeMs = (std::max)(merged.dataCurrentMaxTimeMs, next.dataCurrentMaxTimeMs);
+            merged.dataAverageTimeMs += next.dataAverageTimeMs;
+            merged.dataTotalMinTimeMs = (std::min)(merged.dataTotalMinTimeMs, next.dataTotalMinTimeMs);
+            merged.dataTotalMaxTimeMs = (std::max)(merged.dataTotalMaxTimeMs, next.dataTotalMaxTimeMs);
+        }
+
+        if (count == 0)
+            return false;
+
+        merged.threadAverageTimeMs /= count;
+        merged.dataAverageTimeMs /= count;
+        info = merged;
+        return true;
+    }
+
+    /** @brief Restarts the rolling and session values of the published performance information. This method is thread-safe.*/
+    void resetPerfSnapshot()
+    {
+        for (auto& w : workers)
+            w->resetTiming.store(true, std::memory_order_release);
+    }
+
+#if LS_USE_LATENCY_TRACE
+    /** @brief Gets the per-stage latency trace histograms of the multi-reader. The histograms can be read from any thread.*/
+    LumasonicTraceHistograms& getTraceHistograms() { return traceHistograms; }
+
+    /** @brief Clears the latency trace histograms. This method is thread-safe.*/
+    void resetTraceHistograms() { traceHistograms.reset(); }
+#endif
+
+private:
+    //==============================================================================
+    struct Worker;
+
+    // A decoder, its listeners, and its data ready flag. This is the process
+    // each decoder notifies when new data is available.
+    struct Slot : public LumasonicWaitingProcess
+    {
+        Slot(Worker& w, LumasonicStereoDecoder* d) : worker(w), decoder(d) {}
+
+        void notify() override
+        {
+            notifyNanos.store(LsUtils::monotonicNanos(), std::memory_order_relaxed);
+            ready.store(true, std::memory_order_release);
+            worker.wake(worker.owner.threadMode.load(std::memory_order_relaxed));
+        }
+
+        Worker& worker;
+        LumasonicStereoDecoder* decoder;
+        std::vector<LumasonicStereoColorListener*> listeners;
+        std::atomic<bool> ready { false };
+        std::atomic<uint64_t> notifyNanos { 0 };
+        uint64_t lastDataNanos = 0;
+        bool removed = false;       // set under the worker's lock when the slot leaves the worker
+    };
+
+    // A reading thread and the decoders it services
+    struct Worker
+    {
+        explicit Worker(LumasonicStereoMultiReader& o) : owner(o) {}
+
+        // Called from the producer thread; only the event mode touches the condition
+        void wake(LumasonicThreadModes mode)
+        {
+            if (mode != LumasonicThreadModes::LS_Thread_Event)
+                return;
+
+            epoch.fetch_add(1, std::memory_order_release);
+
+            // Passing through the lock orders the increment before or after the reader's
+            // predicate check, so the notify can't land between the check and the wait
+            {
+                std::lock_guard<std::mutex> sl(waitLock);
+            }
+
+            waitCond.notify_one();
+        }
+
+        void run()
+        {
+            unsigned int seenEpoch = epoch.load(std::memory_order_acquire);
+            bool fullSweep = true;
+            uint64_t lastWakeNanos = LsUtils::monotonicNanos();
+
+            while (owner.running.load(std::memory_order_relaxed))
+            {
+                auto wakeNanos = LsUtils::monotonicNanos();
+                owner.perfHistograms.thread.recordNanos(wakeNanos - lastWakeNanos);
+
+                if (resetTiming.exchange(false, std::memory_order_acq_rel))
+                {
+                    threadTiming.reset();
+                    dataTiming.reset();
+                }
+
+                threadTiming.add((double)(wakeNanos - lastWakeNanos) / 1000000.);
+                lastWakeNanos = wakeNanos;
+
+                auto mode = owner.threadMode.load(std::memory_order_relaxed);
+
+                fullSweep = sweep.exchange(false, std::memory_order_acq_rel) || fullSweep;
+                bool readyOnly = mode == LumasonicThreadModes::LS_Thread_Event && !fullSweep;
+                fullSweep = false;
+
+                if (read(readyOnly))
+                    continue;
+
+                if (mode == LumasonicThreadModes::LS_Thread_Sleep)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                else if (mode == LumasonicThreadModes::LS_Thread_Event)
+                {
+                    std::unique_lock<std::mutex> lock(waitLock);
+
+                    // A timed out wait sweeps every decoder in case a notification was missed
+                    fullSweep = !waitCond.wait_for(lock, std::chrono::milliseconds(10), [&]
+                    {
+                        return epoch.load(std::memory_order_acquire) != seenEpoch || !owner.running.load();
+                    });
+
+                    seenEpoch = epoch.load(std::memory_order_acquire);
+                }
+            }
+        }
+
+        // Drains the decoders of this thread and dispatches to their listeners, then applies
+        // the edits its listeners queued for other threads. Returns true if any sample was read.
+        bool read(bool readyOnly)
+        {
+            bool anyRead;
+
+            {
+                std::lock_guard<std::recursive_mutex> guard(lock);
+                dispatchingWorker() = this;
+                anyRead = dispatch(readyOnly);
+                dispatchingWorker() = nullptr;
+                applying.swap(deferred);
+            }
+
+            // No lock is held here, so the edits are free to lock any worker
+            for (auto& edit : applying)
+                edit();
+
+            applying.clear();
+            return anyRead;
+        }
+
+        bool dispatch(bool readyOnly)
+        {
+            bool anyRead = false;
+            StereoColorSample sc;
+
+            // Indexed loops let listeners edit the lists from within their callbacks. The
+            // slot is held by a shared pointer, so a listener removing its decoder can't free
+            // the slot while it is still being dispatched.
+            for (size_t s = 0; s < slots.size(); ++s)
+            {
+                auto slot = slots[s];
+
+                if (!slot->ready.exchange(false, std::memory_order_acq_rel) && readyOnly)
+                    continue;
+
+                while (slot->decoder->popColorSample(sc))
+                {
+                    anyRead = true;
+
+#if LS_USE_LATENCY_TRACE
+                    auto dequeued = recordDataTiming(*slot);
+                    auto notified = slot->notifyNanos.load(std::memory_order_relaxed);
+                    LumasonicSampleTrace trace { notified <= dequeued ? notified : 0, dequeued, 0, 0 };
+                    LsUtils::currentSampleTrace() = &trace;
+
+                    if (trace.notifyNanos != 0)
+                        owner.traceHistograms.sinceNotify.recordNanos(dequeued - trace.notifyNanos);
+#else
+                    recordDataTiming(*slot);
+#endif
+
+                    bool removed = false;
+
+                    for (size_t l = 0; l < slot->listeners.size(); ++l)
+                    {
+#if LS_USE_LATENCY_TRACE
+                        trace.dispatchNanos = LsUtils::monotonicNanos();
+#endif
+                        slot->listeners[l]->onStereoColorRead(owner, sc);
+#if LS_USE_LATENCY_TRACE
+                        trace.completeNanos = LsUtils::monotonicNanos();
+                        owner.traceHistograms.recordListener(trace);
+#endif
+                        // The decoder may be deleted as soon as it has been removed
+                        if ((removed = slot->removed))
+                            break;
+                    }
+
+#if LS_USE_LATENCY_TRACE
+                    LsUtils::currentSampleTrace() = nullptr;
+#endif
+
+                    if (removed || !owner.running.load(std::memory_order_relaxed) || s >= slots.size() || slots[s] != slot)
+                        return true;
+                }
+            }
+
+            return anyRead;
+        }
+
+        // Records the data interval and notification latency, and returns the dequeue time
+        uint64_t recordDataTiming(Slot& slot)
+        {
+            auto now = LsUtils::monotonicNanos();
+            auto notified = slot.notifyNanos.load(std::memory_order_relaxed);
+
+            if (slot.lastDataNanos != 0)
+            {
+                owner.perfHistograms.data.recordNanos(now - slot.lastDataNanos);
+                dataTiming.add((double)(now - slot.lastDataNanos) / 1000000.);
+                publishTiming();
+            }
+
+            if (notified != 0 && notified <= now)
+                owner.perfHistograms.latency.recordNanos(now - notified);
+
+            slot.lastDataNanos = now;
+            return now;
+        }
+
+        void publishTiming()
+        {
+            LumasonicReadPerfInfo info;
+            info.threadCurrentMinTimeMs = threadTiming.currentMin;
+            info.threadCurrentMaxTimeMs = threadTiming.currentMax;
+            info.threadAverageTimeMs = threadTiming.average;
+            info.threadTotalMinTimeMs = threadTiming.totalMin;
+            info.threadTotalMaxTimeMs = threadTiming.totalMax;
+            info.dataCurrentMinTimeMs = dataTiming.currentMin;
+            info.dataCurrentMaxTimeMs = dataTiming.currentMax;
+            info.dataAverageTimeMs = dataTiming.average;
+            info.dataTotalMinTimeMs = dataTiming.totalMin;
+            info.dataTotalMaxTimeMs = dataTiming.totalMax;
+
+            perfSnapshot.store(info);
+        }
+
+        LumasonicStereoMultiReader& owner;
+        std::recursive_mutex lock;
+        std::vector<std::shared_ptr<Slot>> slots;
+        std::vector<std::function<void()>> deferred;    // edits queued by this thread's listeners, under the lock
+        std::vector<std::function<void()>> applying;    // only touched on this worker's thread
+        std::atomic<int> numSlots { 0 };
+        std::atomic<bool> sweep { true };
+        std::atomic<bool> resetTiming { false };
+        LsUtils::RollingTimingWindow threadTiming;
+        LsUtils::RollingTimingWindow dataTiming;
+        LsUtils::SeqLock<LumasonicReadPerfInfo> perfSnapshot;
+        std::atomic<unsigned int> epoch { 0 };
+        std::mutex waitLock;
+        std::condition_variable waitCond;
+        std::thread thread;
+    };
+
+    //==============================================================================
+    // The registry lock is only ever taken last, never while waiting for a worker's lock
+    Worker* findWorker(LumasonicStereoDecoder* decoder)
+    {
+        std::lock_guard<std::mutex> registry(registryLock);
+        auto it = owners.find(decoder);
+        return it != owners.end() ? it->second : nullptr;
+    }
+
+    void unregisterDecoder(LumasonicStereoDecoder* decoder)
+    {
+        std::lock_guard<std::mutex> registry(registryLock);
+        owners.erase(decoder);
+    }
+
+    template <typename EditFunction>
+    bool editSlot(LumasonicStereoDecoder* decoder, EditFunction edit)
+    {
+        auto* w = findWorker(decoder);
+
+        if (w == nullptr)
+            return false;
+
+        if (deferEdit(w, [this, decoder, edit] { editSlot(decoder, edit); }))
+            return true;
+
+        std::lock_guard<std::recursive_mutex> lock(w->lock);
+
+        for (auto& slot : w->slots)
+            if (slot->decoder == decoder)
+                return edit(*slot);
+
+        return false;
+    }
+
+    // The worker whose listeners are being called on this thread, if any
+    static Worker*& dispatchingWorker()
+    {
+        static thread_local Worker* worker = nullptr;
+        return worker;
+    }
+
+    // A listener holds its worker's lock, so it may only lock that same worker: another worker could
+    // be calling a listener that is waiting for this one. Queues the edit on the calling worker
+    // instead, and returns true, unless the target (or nullptr for every worker) is safe to lock.
+    static bool deferEdit(Worker* target, std::function<void()> edit)
+    {
+        auto* current = dispatchingWorker();
+
+        if (current == nullptr || current == target)
+            return false;
+
+        current->deferred.push_back(std::move(edit));
+        return true;
+    }
+
+    void joinWorkers()
+    {
+        for (auto& w : workers)
+            if (w->thread.joinable() && w->thread.get_id() != std::this_thread::get_id())
+                w->thread.join();
+    }
+
+    //==============================================================================
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::mutex registryLock;
+    std::unordered_map<LumasonicStereoDecoder*, Worker*> owners;   // the worker servicing each decoder, under the registry lock
+    std::atomic<LumasonicThreadModes> threadMode { LumasonicThreadModes::LS_Thread_Sleep };
+    std::atomic<bool> running { false };
+    LumasonicReadPerfHistograms perfHistograms;
+
+#if LS_USE_LATENCY_TRACE
+    LumasonicTraceHistograms traceHistograms;
+#endif
+};
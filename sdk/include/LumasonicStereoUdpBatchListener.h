@@ -0,0 +1,546 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicNet.h"
+#include "LumasonicPacket.h"
+#include "LumasonicPerfStats.h"
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+//==============================================================================
+/**
+    @brief How a @ref LumasonicStereoUdpBatchListener packs a batch of samples into datagrams.
+*/
+enum class LumasonicUdpBatchModes
+{
+    LS_Udp_Batch_Datagrams = 0, ///< One 32 byte datagram per sample, all handed to the kernel in one call (`sendmmsg()` on Linux)
+    LS_Udp_Batch_MultiSample    ///< All samples of the batch packed back to back into a single datagram
+};
+
+//==============================================================================
+/**
+ * @brief Listener class that relays decoded @ref StereoColorSample values over
+ * a UDP socket like @ref LumasonicStereoUdpListener, but accumulates samples
+ * and sends them in batches to cut the number of system calls made on the
+ * reader's thread.
+ *
+ * @details
+ * @ref LumasonicStereoUdpListener makes one `sendto()` call per sample. With
+ * many decoders running, those calls dominate the reader's thread. This
+ * listener holds samples until either the batch is full or holding them any
+ * longer would exceed the configured maximum latency, then sends them all at
+ * once.
+ *
+ * > [!NOTE]
+ * > Values are sent on the reader's thread; no extra thread is created. The
+ * > latency bound is kept by predicting when the next sample will arrive: when
+ * > it would arrive after the deadline, the batch is sent right away. If the
+ * > stream stops, any held samples are sent by @ref flush() or @ref stopUdp().
+ *
+ * > [!NOTE]
+ * > A maximum latency below one sample interval (**5.33 ms** at 48 KHz / 256 samples)
+ * > sends every sample on its own. The default of **11 ms** covers two intervals,
+ * > so up to three samples are sent together at that rate.
+ *
+ * ### Configuring Batching
+ *
+ * ```c++
+ *
+ * auto* udpListener = new LumasonicStereoUdpBatchListener(16, 22.); // up to 16 samples, held for at most 22 ms
+ * udpListener->setMode(LumasonicUdpBatchModes::LS_Udp_Batch_Datagrams);
+ *
+ * UdpListenerConfig cfg;
+ * cfg.localAddress = LS_LOOPBACK_IPV4;
+ * cfg.localPort = 0;
+ * cfg.remoteAddress = LS_LOOPBACK_IPV4;
+ * cfg.remotePort = 8000;
+ * cfg.exclusive = false;
+ *
+ * udpListener->startUdp(cfg);
+ * lsReader->addListener(udpListener);
+ *
+ * ```
+ *
+ * A maximum latency of **0** sends every sample as soon as it is read, which
+ * matches @ref LumasonicStereoUdpListener.
+ *
+ * ### Sending to Several Destinations
+ *
+ * One listener can send the same stream to several hosts. Each sample is
+ * serialized once and every destination gets the same bytes in the same batch.
+ *
+ * ```c++
+ *
+ * UdpFanOutConfig cfg {};
+ * cfg.localAddress = 0;                                // any interface
+ * cfg.destinations[0] = { ledControllerAddr, 8000 };
+ * cfg.destinations[1] = { monitorAddr, 8001 };
+ * cfg.destinations[2] = { 0xEF000001, 8000 };          // multicast group 239.0.0.1
+ * cfg.numDestinations = 3;
+ * cfg.multicastTtl = 4;
+ *
+ * udpListener->startUdp(cfg);
+ *
+ * auto monitorPackets = udpListener->getNumPacketsSent(1);
+ * auto monitorErrors = udpListener->getNumSendErrors(1);
+ *
+ * ```
+ *
+ * ### Sending over IPv6
+ *
+ * The addresses of @ref UdpFanOutConfig and @ref UdpListenerAddressConfig are
+ * @ref NetAddress values. Binding to @ref NetAddress::anyIPv6() opens a dual-stack
+ * socket, so IPv4 and IPv6 destinations can share one listener.
+ *
+ * ```c++
+ *
+ * UdpFanOutConfig cfg {};
+ * cfg.localAddress = NetAddress::anyIPv6();
+ * LsUtils::addressFromStr("fd00::20", cfg.destinations[0].address);
+ * cfg.destinations[0].port = 8000;
+ * cfg.destinations[1] = { LumasonicStereoUdpListener::ipv4AddressFromStr("192.168.1.50"), 8000 };
+ * cfg.numDestinations = 2;
+ *
+ * udpListener->startUdp(cfg);
+ *
+ * ```
+ *
+ * ### Measuring the Savings
+ *
+ * ```c++
+ *
+ * auto packets = udpListener->getNumPacketsSent();     // datagrams sent
+ * auto syscalls = udpListener->getNumSyscalls();       // send system calls made for them
+ *
+ * ```
+ *
+ * ### UDP Data Payload
+ *
+ * In @ref LumasonicUdpBatchModes::LS_Udp_Batch_Datagrams mode every datagram
+ * holds one **32 byte** sample, exactly as documented for @ref LumasonicStereoUdpListener,
+ * so existing receivers work unchanged.
+ *
+ * In @ref LumasonicUdpBatchModes::LS_Udp_Batch_MultiSample mode a datagram
+ * holds 1 or more of those 32 byte samples back to back, oldest first. Receivers
+ * divide the datagram size by @ref LS_STEREO_COLOR_SAMPLE_SIZE to get the number
+ * of samples. A datagram never exceeds @ref LS_UDP_MAX_PAYLOAD_SIZE bytes.
+ *
+ * With @ref setPacketFormat() set to @ref LumasonicPacketFormats::LS_Packet_V2,
+ * every datagram starts with the 16 byte v2 header carrying the stream ID set
+ * with @ref setStreamId() and a sequence number that restarts at 0 with each
+ * call to @ref startUdp(). Use @ref LsUtils::PacketView to parse either format.
+ *
+ * For 8 or 16-bit lighting, @ref setSampleEncoding() packs each sample into 16
+ * (@ref LumasonicSampleEncodings::LS_Encoding_U16) or 8 bytes
+ * (@ref LumasonicSampleEncodings::LS_Encoding_U8) with delta-coded timestamps.
+ * A batch whose timestamps span more than the encoding's delta range is split
+ * across datagrams.
+ */
+class LumasonicStereoUdpBatchListener : public LumasonicStereoColorListener
+{
+public:
+    //==============================================================================
+    /** @brief Constructor
+        @param maxBatchSamples      The maximum number of samples held before they are sent.
+        @param maxLatencyMs         The maximum time in milliseconds a sample is held before it is sent.
+        @param batchMode            How the samples of a batch are packed into datagrams.
+    */
+    explicit LumasonicStereoUdpBatchListener(int maxBatchSamples = 16, double maxLatencyMs = 11.,
+                                             LumasonicUdpBatchModes batchMode = LumasonicUdpBatchModes::LS_Udp_Batch_Datagrams)
+        : mode(batchMode)
+    {
+        setMaxBatchSize(maxBatchSamples);
+        setMaxLatency(maxLatencyMs);
+    }
+
+    /** @brief Destructor. Sends any held samples and closes the socket.*/
+    ~LumasonicStereoUdpBatchListener() override { stopUdp(); }
+
+    //==============================================================================
+    /** @brief The unique ID of the instance.*/
+    int id = -1;
+
+    /** @brief Configures the UDP settings for the listener. Any held samples are sent on the previous socket first.
+        @param config               The UDP socket configuration to use for sending.
+        @return                     True if starting UDP succeeded, False if it failed.
+    */
+    bool startUdp(UdpListenerConfig config)
+    {
+        UdpFanOutConfig fanOut {};
+        fanOut.localAddress = config.localAddress;
+        fanOut.localPort = config.localPort;
+        fanOut.exclusive = config.exclusive;
+        fanOut.destinations[0] = { config.remoteAddress, config.remotePort };
+        fanOut.numDestinations = 1;
+        return startUdp(fanOut);
+    }
+
+    /** @brief Configures the UDP settings for the listener with IPv4 or IPv6 addresses.
+        Any held samples are sent on the previous socket first.
+        @param config               The UDP socket configuration to use for sending.
+        @return                     True if starting UDP succeeded, False if it failed.
+    */
+    bool startUdp(const UdpListenerAddressConfig& config)
+    {
+        UdpFanOutConfig fanOut {};
+        fanOut.localAddress = config.localAddress;
+        fanOut.localPort = config.localPort;
+        fanOut.exclusive = config.exclusive;
+        fanOut.destinations[0] = { config.remoteAddress, config.remotePort };
+        fanOut.numDestinations = 1;
+        return startUdp(fanOut);
+    }
+
+    /** @brief Configures the UDP settings for the listener to send every sample to several destinations.
+        Any held samples are sent on the previous socket first. The per-destination counters are reset.
+        @param config               The UDP socket configuration to use for sending.
+        @return                     True if starting UDP succeeded, False if it failed. A configuration with more than
+                                    @ref LS_UDP_MAX_DESTINATIONS destinations fails, leaving the current socket untouched.
+    */
+    bool startUdp(const UdpFanOutConfig& config)
+    {
+        if (config.numDestinations < 0 || config.numDestinations > LS_UDP_MAX_DESTINATIONS)
+            return false;
+
+        std::lock_guard<std::mutex> sl(lock);
+
+        sendPending();
+        socket.close();
+
+        int count = config.numDestinations;
+        bool anyMulticast = false;
+
+        for (int i = 0; i < count; ++i)
+        {
+            destinations[i] = config.destinations[i];
+            destinationStats[i].packetsSent.store(0, std::memory_order_relaxed);
+            destinationStats[i].sendErrors.store(0, std::memory_order_relaxed);
+            anyMulticast |= destinations[i].address.isMulticast();
+        }
+
+        numDestinations.store(count);
+        nextSequence = 0;
+
+        if (!socket.open(config.localAddress, config.localPort, config.exclusive))
+            return false;
+
+        if (anyMulticast && !socket.setMulticastOptions(config.multicastTtl, config.multicastInterface, config.multicastLoopback))
+        {
+            socket.close();
+            return false;
+        }
+
+        return true;
+    }
+
+    /** @brief Sends any held samples, then stops UDP networking and releases the current bound UDP socket if one exists.*/
+    void stopUdp()
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        sendPending();
+        socket.close();
+    }
+
+    /** @brief Whether the socket is currently bound and open.*/
+    bool isSocketOpen()
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        return socket.isOpen();
+    }
+
+    /** @brief Sends any held samples right away.*/
+    void flush()
+    {
+        std::lock_guard<std::mutex> sl(lock);
+        sendPending();
+    }
+
+    //==============================================================================
+    /** @brief Gets the maximum number of samples held before they are sent. This method is thread-safe/atomic.*/
+    int getMaxBatchSize() const { return maxBatch.load(); }
+
+    /** @brief Sets the maximum number of samples held before they are sent, from 1 to @ref LS_UDP_MAX_BATCH.
+        In multi-sample mode the batch is also limited to the samples that fit in @ref LS_UDP_MAX_PAYLOAD_SIZE bytes.
+        This method is thread-safe/atomic.
+    */
+    void setMaxBatchSize(int maxBatchSamples)
+    {
+        maxBatch.store(maxBatchSamples < 1 ? 1 : (maxBatchSamples > LS_UDP_MAX_BATCH ? LS_UDP_MAX_BATCH : maxBatchSamples));
+    }
+
+    /** @brief Gets the maximum time in milliseconds a sample is held before it is sent. This method is thread-safe/atomic.*/
+    double getMaxLatency() const { return maxLatencyNanos.load() / 1e6; }
+
+    /** @brief Sets the maximum time in milliseconds a sample is held before it is sent. This method is thread-safe/atomic.*/
+    void setMaxLatency(double maxLatencyMs) { maxLatencyNanos.store(maxLatencyMs > 0. ? (unsigned long long)(maxLatencyMs * 1e6) : 0); }
+
+    /** @brief Gets how the samples of a batch are packed into datagrams. This method is thread-safe/atomic.*/
+    LumasonicUdpBatchModes getMode() const { return mode.load(); }
+
+    /** @brief Sets how the samples of a batch are packed into datagrams. Takes effect from the next batch. This method is thread-safe/atomic.*/
+    void setMode(LumasonicUdpBatchModes newMode) { mode.store(newMode); }
+
+    /** @brief Gets the packet format of the datagrams sent. This method is thread-safe/atomic.*/
+    LumasonicPacketFormats getPacketFormat() const { return packetFormat.load(); }
+
+    /** @brief Sets the packet format of the datagrams sent. The default is @ref LumasonicPacketFormats::LS_Packet_V1
+        so existing receivers keep working. Takes effect from the next batch. This method is thread-safe/atomic.
+    */
+    void setPacketFormat(LumasonicPacketFormats format) { packetFormat.store(format); }
+
+    /** @brief Gets the encoding of the samples sent. This method is thread-safe/atomic.*/
+    LumasonicSampleEncodings getSampleEncoding() const { return sampleEncoding.load(); }
+
+    /** @brief Sets the encoding of the samples sent. The quantized encodings shrink a sample to 16 or 8 bytes
+        and are always sent in v2 packets, whatever @ref setPacketFormat() is set to. Takes effect from the
+        next batch. This method is thread-safe/atomic.
+    */
+    void setSampleEncoding(LumasonicSampleEncodings encoding) { sampleEncoding.store(encoding); }
+
+    /** @brief Gets the stream ID written to v2 packets. This method is thread-safe/atomic.*/
+    uint32_t getStreamId() const { return streamId.load(); }
+
+    /** @brief Sets the stream ID written to v2 packets, so receivers can tell streams on a shared port apart.
+        This method is thread-safe/atomic.
+    */
+    void setStreamId(uint32_t newStreamId) { streamId.store(newStreamId); }
+
+    //==============================================================================
+    /** @brief Gets the total number of packets (datagrams) sent to all destinations. Use @ref resetNumPacketsSent() to reset this counter.*/
+    unsigned long long getNumPacketsSent() const { return numPacketsSent.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the total number of samples sent to all destinations. Use @ref resetNumPacketsSent() to reset this counter.*/
+    unsigned long long getNumSamplesSent() const { return numSamplesSent.load(std::memory_order_relaxed); }
+
+    /** @brief Resets the number of packets and samples sent, including the per-destination counters, to 0.*/
+    void resetNumPacketsSent()
+    {
+        numPacketsSent.store(0, std::memory_order_relaxed);
+        numSamplesSent.store(0, std::memory_order_relaxed);
+
+        for (auto& stats : destinationStats)
+        {
+            stats.packetsSent.store(0, std::memory_order_relaxed);
+            stats.sendErrors.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /** @brief Gets the number of destinations the listener currently sends to.*/
+    int getNumDestinations() const { return numDestinations.load(); }
+
+    /** @brief Gets the number of packets (datagrams) sent to one destination.
+        @param destinationIndex     The index of the destination in the @ref UdpFanOutConfig passed to @ref startUdp().
+    */
+    unsigned long long getNumPacketsSent(int destinationIndex) const
+    {
+        return isValidDestination(destinationIndex) ? destinationStats[destinationIndex].packetsSent.load(std::memory_order_relaxed) : 0;
+    }
+
+    /** @brief Gets the number of packets (datagrams) that failed to send to one destination.
+        @param destinationIndex     The index of the destination in the @ref UdpFanOutConfig passed to @ref startUdp().
+    */
+    unsigned long long getNumSendErrors(int destinationIndex) const
+    {
+        return isValidDestination(destinationIndex) ? destinationStats[destinationIndex].sendErrors.load(std::memory_order_relaxed) : 0;
+    }
+
+    /** @brief Gets the total number of send system calls made. Use @ref resetNumSyscalls() to reset this counter.*/
+    unsigned long long getNumSyscalls() const { return socket.getNumSyscalls(); }
+
+    /** @brief Resets the number of send system calls to 0.*/
+    void resetNumSyscalls() { socket.resetNumSyscalls(); }
+
+    //==============================================================================
+    /** @brief This method is called when the reader's thread has new color data available.
+        @param process              A reference to the running process that called this listener.
+        @param stereoColor          The stereo color sample value that has been read.
+    */
+    void onStereoColorRead(LumasonicRunningProcess& /*process*/, StereoColorSample stereoColor) override
+    {
+        std::lock_guard<std::mutex> sl(lock);
+
+        if (!socket.isOpen())
+            return;
+
+        auto now = LsUtils::monotonicNanos();
+
+        // Track a conservative estimate of the gap to the next sample: jump up to
+        // longer gaps at once and decay slowly towards shorter ones
+        if (lastArrivalNanos != 0)
+        {
+            auto gap = now - lastArrivalNanos;
+            expectedGapNanos = gap > expectedGapNanos ? gap : expectedGapNanos - (expectedGapNanos - gap) / 8;
+        }
+
+        lastArrivalNanos = now;
+
+        if (numPending == 0)
+            firstPendingNanos = now;
+
+        pending[numPending++] = stereoColor;
+
+        int limit = maxBatch.load();
+        if (mode.load() == LumasonicUdpBatchModes::LS_Udp_Batch_MultiSample)
+        {
+            int perDatagram = maxSamplesPerDatagram(sampleEncoding.load());
+            limit = limit < perDatagram ? limit : perDatagram;
+        }
+
+        bool full = numPending >= limit;
+        bool late = (now - firstPendingNanos) + expectedGapNanos >= maxLatencyNanos.load();
+
+        if (full || late)
+            sendPending();
+    }
+
+private:
+    //==============================================================================
+    // The number of samples that fit in one datagram of either packet format
+    static int maxSamplesPerDatagram(LumasonicSampleEncodings encoding)
+    {
+        return (int)((LS_UDP_MAX_PAYLOAD_SIZE - LsUtils::payloadOffsetForEncoding(encoding)) / LsUtils::sampleSizeForEncoding(encoding));
+    }
+
+    struct DestinationStats
+    {
+        std::atomic<unsigned long long> packetsSent { 0 };
+        std::atomic<unsigned long long> sendErrors { 0 };
+    };
+
+    bool isValidDestination(int destinationIndex) const { return destinationIndex >= 0 && destinationIndex < LS_UDP_MAX_DESTINATIONS; }
+
+    // Queues one serialized payload for every destination
+    void addMessages(const unsigned char* data, size_t size, int count, int& numMessages)
+    {
+        for (int d = 0; d < count; ++d)
+            messages[numMessages++] = { data, size, destinations[d].address, destinations[d].port };
+    }
+
+    // Must be called with the lock held
+    void sendPending()
+    {
+        int count = numDestinations.load();
+
+        if (numPending == 0 || count == 0)
+        {
+            numPending = 0;
+            return;
+        }
+
+        // Quantized samples only exist in v2 packets
+        auto encoding = sampleEncoding.load();
+        bool v2 = packetFormat.load() == LumasonicPacketFormats::LS_Packet_V2 || encoding != LumasonicSampleEncodings::LS_Encoding_Float32;
+        int perDatagram = mode.load() == LumasonicUdpBatchModes::LS_Udp_Batch_MultiSample ? numPending : 1;
+        int numMessages = 0;
+        int numDatagrams = 0;
+        size_t packetBytes = 0;
+
+        // Each datagram is serialized once and the same bytes are queued for every destination
+        for (int first = 0; first < numPending;)
+        {
+            int wanted = numPending - first < perDatagram ? numPending - first : perDatagram;
+            auto* packet = packetBuffer + packetBytes;
+            size_t size = 0;
+            int written = 0;
+
+            if (v2)
+            {
+                size = LsUtils::writePacketV2(packet, LS_UDP_MAX_PAYLOAD_SIZE, streamId.load(), nextSequence++,
+                                              pending + first, wanted, encoding, &written);
+            }
+            else
+            {
+                int fit = LS_UDP_MAX_PAYLOAD_SIZE / LS_STEREO_COLOR_SAMPLE_SIZE;
+                written = wanted < fit ? wanted : fit;
+
+                for (int i = 0; i < written; ++i)
+                    LsUtils::stereoColorSampleToData(pending[first + i], packet + i * LS_STEREO_COLOR_SAMPLE_SIZE);
+
+                size = (size_t)written * LS_STEREO_COLOR_SAMPLE_SIZE;
+            }
+
+            addMessages(packet, size, count, numMessages);
+            datagramSamples[numDatagrams++] = written;
+            packetBytes += size;
+            first += written;
+        }
+
+        int sent = socket.sendBatch(messages, numMessages, sentFlags);
+        unsigned long long samples = 0;
+
+        for (int i = 0; i < numMessages; ++i)
+        {
+            auto& stats = destinationStats[i % count];
+
+            if (sentFlags[i])
+            {
+                stats.packetsSent.fetch_add(1, std::memory_order_relaxed);
+                samples += (unsigned long long)datagramSamples[i / count];
+            }
+            else
+            {
+                stats.sendErrors.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        numPacketsSent.fetch_add((unsigned long long)sent, std::memory_order_relaxed);
+        numSamplesSent.fetch_add(samples, std::memory_order_relaxed);
+
+        // Unsent samples are dropped, like a failed send of the unbatched listener
+        numPending = 0;
+    }
+
+    //==============================================================================
+    std::mutex lock;
+    LsUtils::UdpSocket socket;
+    UdpEndpoint destinations[LS_UDP_MAX_DESTINATIONS] {};
+    std::atomic<int> numDestinations { 0 };
+    DestinationStats destinationStats[LS_UDP_MAX_DESTINATIONS];
+
+    std::atomic<int> maxBatch { 16 };
+    std::atomic<unsigned long long> maxLatencyNanos { 0 };
+    std::atomic<LumasonicUdpBatchModes> mode;
+    std::atomic<LumasonicPacketFormats> packetFormat { LumasonicPacketFormats::LS_Packet_V1 };
+    std::atomic<LumasonicSampleEncodings> sampleEncoding { LumasonicSampleEncodings::LS_Encoding_Float32 };
+    std::atomic<uint32_t> streamId { 0 };
+    uint32_t nextSequence = 0;
+
+    StereoColorSample pending[LS_UDP_MAX_BATCH];
+    int datagramSamples[LS_UDP_MAX_BATCH];
+    unsigned char packetBuffer[LS_UDP_MAX_BATCH * (LS_PACKET_V2_HEADER_SIZE + LS_PACKET_V2_BASE_TS_SIZE + LS_STEREO_COLOR_SAMPLE_SIZE)];
+    LsUtils::UdpMessage messages[LS_UDP_MAX_BATCH * LS_UDP_MAX_DESTINATIONS];
+    bool sentFlags[LS_UDP_MAX_BATCH * LS_UDP_MAX_DESTINATIONS];
+    int numPending = 0;
+    unsigned long long firstPendingNanos = 0;
+    unsigned long long lastArrivalNanos = 0;
+    unsigned long long expectedGapNanos = 0;
+
+    std::atomic<unsigned long long> numPacketsSent { 0 };
+    std::atomic<unsigned long long> numSamplesSent { 0 };
+};
@@ -36,6 +36,11 @@
  * > [!NOTE]
  * > Values are sent on the reader's thread. The listener will not send values
  * > over UDP until you start the connection using @ref startUdp(UdpListenerConfig).
+ *
+ * > [!NOTE]
+ * > The listener only supports IPv4. To send to IPv6 hosts or through a dual-stack
+ * > socket, use the header-only @ref LumasonicStereoUdpBatchListener with a
+ * > @ref UdpListenerAddressConfig instead.
  * 
  * ### Configuring the Socket Connection
  * 
@@ -140,6 +145,10 @@
  * 4    | 32-bit float            | blue level right
  * 
  * Values with a **timestamp** of **0** indicate **no data** was available.
+ *
+ * This is version 1 of the packet format. @ref LumasonicStereoUdpBatchListener
+ * can also send version 2, which adds a stream ID and sequence number
+ * (see @ref LumasonicPacketFormats).
  */
 class LumasonicStereoUdpListener : public LumasonicStereoColorListener
 {
@@ -0,0 +1,378 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicNet.h"
+#include "LumasonicPacket.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The number of v2 streams whose sequence numbers a receiver tracks at once
+#ifndef LS_UDP_RECEIVER_MAX_STREAMS
+#define LS_UDP_RECEIVER_MAX_STREAMS     8
+#endif
+
+//==============================================================================
+/**
+ * @brief Receives the stereo color datagrams sent by the UDP listeners and
+ * dispatches their samples to registered @ref LumasonicStereoColorListener
+ * instances, on its own thread.
+ *
+ * @details
+ * The receiver is the other end of @ref LumasonicStereoUdpListener and
+ * @ref LumasonicStereoUdpBatchListener. It binds a port, pulls every waiting
+ * datagram with a single batched system call (`recvmmsg()` on Linux), and parses
+ * them in place in its receive buffers with @ref LsUtils::PacketView: v1 and v2
+ * packets and all @ref LumasonicSampleEncodings are accepted. Samples are
+ * decoded one at a time straight out of the receive buffers and passed to every
+ * listener in order.
+ *
+ * For v2 packets the sequence numbers of each stream are tracked: lost and
+ * reordered datagrams are counted, and duplicates are dropped. A sender that
+ * restarts its sequence numbers is picked up again after a few datagrams.
+ *
+ * Because any listener can be registered, a receiver feeding UDP, sACN or
+ * Art-Net listeners acts as a relay: one decoder sends to a few relays, and each
+ * relay drives its own light rigs.
+ *
+ * ### Relaying a Stream
+ *
+ * ```c++
+ *
+ * UdpReceiverConfig cfg {};
+ * cfg.localPort = 7000;
+ * cfg.receiveBufferSize = 1 << 20;                     // absorb bursts while the listeners run
+ *
+ * auto* receiver = new LumasonicStereoUdpReceiver();
+ * receiver->addListener(sacnListener);                 // drive a local LED rig
+ * receiver->addListener(udpBatchListener);             // and pass the stream on
+ * receiver->start(cfg);
+ *
+ * ```
+ *
+ * The @ref LumasonicRunningProcess passed to the listeners is the receiver
+ * itself: calling `signalProcessShouldExit()` stops the receiving thread.
+ */
+class LumasonicStereoUdpReceiver : public LumasonicRunningProcess
+{
+public:
+    //==============================================================================
+    /** @brief Constructor
+        @param maxBatch             The largest number of datagrams pulled by one system call, from 1 to @ref LS_UDP_MAX_BATCH.
+    */
+    explicit LumasonicStereoUdpReceiver(int maxBatch = LS_UDP_MAX_BATCH)
+        : batchSize((std::max)(1, (std::min)(maxBatch, LS_UDP_MAX_BATCH))),
+          buffers((size_t)batchSize * LS_UDP_RECEIVE_BUFFER_SIZE)
+    {
+        for (int i = 0; i < batchSize; ++i)
+            messages[i] = { buffers.data() + (size_t)i * LS_UDP_RECEIVE_BUFFER_SIZE, LS_UDP_RECEIVE_BUFFER_SIZE, 0, 0, 0 };
+    }
+
+    /** @brief Destructor. Stops the receiving thread.*/
+    virtual ~LumasonicStereoUdpReceiver() { stop(); }
+
+    //==============================================================================
+    /** @brief The unique ID of the instance.*/
+    int id = -1;
+
+    /** @brief Binds the socket and starts the receiving thread. A running receiver is stopped first.
+        This method must not be called from a listener callback, as the receiving thread can't wait for itself to exit.
+        @param config               The network configuration to receive with.
+        @return                     True if the socket was bound and the thread started, False if not.
+    */
+    bool start(const UdpReceiverConfig& config)
+    {
+        stop();
+
+        // Called from a listener: the previous thread is still running this call
+        if (thread.joinable())
+            return false;
+
+        if (!socket.open(config.localAddress, config.localPort, config.exclusive)
+            || !socket.setReceiveTimeout(receiveTimeoutMs)
+            || (config.receiveBufferSize > 0 && !socket.setReceiveBufferSize(config.receiveBufferSize))
+            || (config.multicastGroup.isMulticast()
+                && !socket.joinMulticastGroup(config.multicastGroup, config.localAddress.isIPv4() ? config.localAddress.toIPv4() : 0)))
+        {
+            socket.close();
+            return false;
+        }
+
+        for (auto& stream : streams)
+            stream = {};
+
+        running.store(true);
+        thread = std::thread(&LumasonicStereoUdpReceiver::run, this);
+        return true;
+    }
+
+    /** @brief Stops the receiving thread and releases the socket. When called from a listener callback,
+        the receiving thread releases the socket itself once the callback returns.
+    */
+    void stop()
+    {
+        running.store(false);
+
+        if (thread.joinable() && thread.get_id() != std::this_thread::get_id())
+            thread.join();
+
+        if (!thread.joinable())
+            socket.close();
+    }
+
+    /** @brief Whether the receiving thread is currently running. This method is thread-safe.*/
+    bool isRunning() const { return running.load(); }
+
+    /** @brief Called by registered listeners to stop the receiving thread.*/
+    void signalProcessShouldExit() override { running.store(false); }
+
+    //==============================================================================
+    /** @brief Adds a listener to be notified of each received sample. This method is thread-safe.
+        @return                     True if the listener was added, False if it was null or already added.
+    */
+    bool addListener(LumasonicStereoColorListener* listener)
+    {
+        std::lock_guard<std::recursive_mutex> sl(lock);
+
+        if (listener == nullptr || std::find(listeners.begin(), listeners.end(), listener) != listeners.end())
+            return false;
+
+        listeners.push_back(listener);
+        return true;
+    }
+
+    /** @brief Removes an existing listener. This method is thread-safe.
+        @return                     True if the listener was removed, False if it was not found.
+    */
+    bool removeListener(LumasonicStereoColorListener* listener)
+    {
+        std::lock_guard<std::recursive_mutex> sl(lock);
+        auto it = std::find(listeners.begin(), listeners.end(), listener);
+
+        if (it == listeners.end())
+            return false;
+
+        listeners.erase(it);
+        return true;
+    }
+
+    /** @brief Removes all listeners. This method is thread-safe.*/
+    void clearListeners()
+    {
+        std::lock_guard<std::recursive_mutex> sl(lock);
+        listeners.clear();
+    }
+
+    /** @brief Only dispatches v2 packets of one stream. This method is thread-safe/atomic.
+        @param streamId             The stream ID to accept, or 0 to accept every stream and v1 packets.
+    */
+    void setStreamFilter(uint32_t streamId) { streamFilter.store(streamId); }
+
+    /** @brief Gets the stream ID accepted, or 0 if every stream is accepted. This method is thread-safe/atomic.*/
+    uint32_t getStreamFilter() const { return streamFilter.load(); }
+
+    //==============================================================================
+    /** @brief Gets the total number of datagrams received, including invalid and duplicate ones.*/
+    unsigned long long getNumPacketsReceived() const { return numPackets.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the total number of samples dispatched to the listeners.*/
+    unsigned long long getNumSamplesReceived() const { return numSamples.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the number of datagrams that were not Lumasonic packets, or were truncated.*/
+    unsigned long long getNumInvalidPackets() const { return numInvalid.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the number of v2 datagrams skipped over by the sequence numbers and not received since.*/
+    unsigned long long getNumLostPackets() const { return numLost.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the number of v2 datagrams that arrived after a newer one of the same stream.*/
+    unsigned long long getNumReorderedPackets() const { return numReordered.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the number of v2 datagrams dropped as duplicates, or as too late to tell.*/
+    unsigned long long getNumDuplicatePackets() const { return numDuplicates.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the number of times a v2 stream started its sequence numbers over.*/
+    unsigned long long getNumStreamRestarts() const { return numRestarts.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the total number of receive system calls made.*/
+    unsigned long long getNumSyscalls() const { return socket.getNumReceiveSyscalls(); }
+
+    /** @brief Resets all counters to 0. The sequence tracking of each stream starts over.*/
+    void resetCounters()
+    {
+        numPackets.store(0, std::memory_order_relaxed);
+        numSamples.store(0, std::memory_order_relaxed);
+        numInvalid.store(0, std::memory_order_relaxed);
+        numLost.store(0, std::memory_order_relaxed);
+        numReordered.store(0, std::memory_order_relaxed);
+        numDuplicates.store(0, std::memory_order_relaxed);
+        numRestarts.store(0, std::memory_order_relaxed);
+        socket.resetNumReceiveSyscalls();
+        resetStreams.store(true, std::memory_order_release);
+    }
+
+private:
+    //==============================================================================
+    // The sequence tracking of one v2 stream; only touched on the receiving thread
+    struct Stream
+    {
+        bool used;
+        uint32_t id;
+        LsUtils::SequenceTracker tracker;
+    };
+
+    void run()
+    {
+        while (running.load(std::memory_order_relaxed))
+        {
+            int count = socket.receiveBatch(messages, batchSize);
+
+            if (count < 0)
+                break;
+
+            if (resetStreams.exchange(false, std::memory_order_acq_rel))
+                for (auto& stream : streams)
+                    stream = {};
+
+            numPackets.fetch_add((unsigned long long)count, std::memory_order_relaxed);
+
+            std::lock_guard<std::recursive_mutex> sl(lock);
+
+            for (int i = 0; i < count && running.load(std::memory_order_relaxed); ++i)
+                dispatch(messages[i]);
+        }
+
+        // A stop() from a listener can't join this thread, so the socket is released here as well
+        socket.close();
+        running.store(false);
+    }
+
+    void dispatch(const LsUtils::UdpReceivedMessage& message)
+    {
+        // A datagram longer than the buffer was cut short and can't be trusted
+        if (message.size >= message.capacity)
+        {
+            numInvalid.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        LsUtils::PacketView packet(message.data, message.size);
+
+        if (!packet.isValid())
+        {
+            numInvalid.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto filter = streamFilter.load(std::memory_order_relaxed);
+
+        if (packet.hasSequence())
+        {
+            if (filter != 0 && packet.getStreamId() != filter)
+                return;
+
+            if (!track(packet.getStreamId(), packet.getSequence()))
+                return;
+        }
+        else if (filter != 0)
+        {
+            return;
+        }
+
+        for (int s = 0; s < packet.getNumSamples(); ++s)
+        {
+            auto sc = packet.getSample(s);
+
+            // Indexed loop lets listeners edit the list from within their callbacks
+            for (size_t l = 0; l < listeners.size(); ++l)
+                listeners[l]->onStereoColorRead(*this, sc);
+        }
+
+        numSamples.fetch_add((unsigned long long)packet.getNumSamples(), std::memory_order_relaxed);
+    }
+
+    // Updates the stream's sequence tracker; returns false if the datagram should be dropped
+    bool track(uint32_t streamId, uint32_t sequence)
+    {
+        Stream* stream = nullptr;
+
+        for (auto& s : streams)
+        {
+            if (s.used && s.id == streamId)
+            {
+                stream = &s;
+                break;
+            }
+
+            if (!s.used && stream == nullptr)
+                stream = &s;
+        }
+
+        // More streams than slots: accept without tracking
+        if (stream == nullptr)
+            return true;
+
+        if (!stream->used)
+            *stream = { true, streamId, {} };
+
+        auto before = stream->tracker;
+        bool accepted = stream->tracker.update(sequence);
+
+        // A late datagram lowers the lost count; the unsigned wrap-around subtracts it again
+        numLost.fetch_add(stream->tracker.lost - before.lost, std::memory_order_relaxed);
+        numReordered.fetch_add(stream->tracker.reordered - before.reordered, std::memory_order_relaxed);
+        numDuplicates.fetch_add(stream->tracker.duplicates - before.duplicates, std::memory_order_relaxed);
+        numRestarts.fetch_add(stream->tracker.restarts - before.restarts, std::memory_order_relaxed);
+        return accepted;
+    }
+
+    //==============================================================================
+    static constexpr int receiveTimeoutMs = 100;    // how quickly the thread notices stop()
+
+    const int batchSize;
+    std::vector<unsigned char> buffers;             // one receive buffer per datagram of a batch, allocated once
+    LsUtils::UdpReceivedMessage messages[LS_UDP_MAX_BATCH];
+    LsUtils::UdpSocket socket;
+    Stream streams[LS_UDP_RECEIVER_MAX_STREAMS] {};
+
+    std::recursive_mutex lock;
+    std::vector<LumasonicStereoColorListener*> listeners;
+    std::atomic<bool> running { false };
+    std::atomic<bool> resetStreams { false };
+    std::atomic<uint32_t> streamFilter { 0 };
+    std::thread thread;
+
+    std::atomic<unsigned long long> numPackets { 0 };
+    std::atomic<unsigned long long> numSamples { 0 };
+    std::atomic<unsigned long long> numInvalid { 0 };
+    std::atomic<unsigned long long> numLost { 0 };
+    std::atomic<unsigned long long> numReordered { 0 };
+    std::atomic<unsigned long long> numDuplicates { 0 };
+    std::atomic<unsigned long long> numRestarts { 0 };
+};
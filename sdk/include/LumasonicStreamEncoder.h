@@ -0,0 +1,407 @@
+/*
+  ==============================================================================
+
+   This file is part of the Lumasonic SDK.
+   Copyright (c) 2025 - Cymatic Somatics Inc.
+
+   This version of the Lumasonic SDK is an archived version and no longer
+   commercially supported.
+
+   The code included in this file is provided under the terms of the MIT license.
+   https://mit-license.org/
+   https://github.com/Lumasonic/Lumasonic/blob/main/LICENSE
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE LUMASONIC SDK IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE,
+   ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#pragma once
+
+#include "LumasonicCommon.h"
+#include "LumasonicUtils.h"
+#include <cstdio>
+#include <vector>
+
+// The number of samples between automation updates of a stream encoder
+#ifndef LS_STREAM_ENCODER_BLOCK
+#define LS_STREAM_ENCODER_BLOCK     32
+#endif
+
+//==============================================================================
+/**
+ * @brief A stereo color value at a point in time, used to automate a @ref LumasonicStreamEncoder.
+ */
+struct ColorKeyframe
+{
+    double time;            ///< The time of the keyframe in seconds from the start of the stream.
+    float r0, g0, b0;       ///< The left red, green and blue values (0.0 - 1.0).
+    float r1, g1, b1;       ///< The right red, green and blue values (0.0 - 1.0).
+};
+
+//==============================================================================
+/**
+ * @brief An encoder that renders a color track, given as timestamped keyframes,
+ * into a Lumasonic, SpectraStrobe or AudioStrobe encoded stereo audio stream.
+ *
+ * @details
+ * Unlike @ref LsUtils::StaticLumasonicEncoder, which jumps to each new color set,
+ * the stream encoder is built for producing content and test material:
+ *
+ * - colors are interpolated linearly from one keyframe to the next;
+ * - every @ref LS_STREAM_ENCODER_BLOCK samples the tone gains are updated, and
+ *   each gain ramps linearly per sample to its new value, so there are no steps
+ *   in the carrier levels;
+ * - a color may change by at most 1.0 per ramp time (see @ref setRampTime()), so
+ *   hard cuts between keyframes are smoothed instead of splattering the carriers.
+ *
+ * The tones are rendered by an @ref LsUtils::OscillatorBank, which advances two
+ * tones per SSE2 instruction and only calls `std::sin()` once per tone every
+ * @ref LS_TONE_RESYNC_INTERVAL samples, so encoding runs far faster than realtime.
+ *
+ * ### Codecs
+ *
+ * Codec         | Tones                                    | Channel levels
+ * --------------|------------------------------------------|------------------------------------------
+ * Lumasonic     | reference, red, green, blue (LS_*_FREQ)  | reference at full level, colors scaled per channel
+ * SpectraStrobe | reference, red, green, blue (SS_*_FREQ)  | reference panned left/right by a sine LFO at @ref SS_REF_PAN_LFO_FREQ, colors scaled per channel
+ * AudioStrobe   | one tone (@ref AS_TONE_FREQ)             | the brightest of each channel's red, green and blue values
+ *
+ * The SpectraStrobe reference uses the equal-power pan law of
+ * @ref LsUtils::spectraStrobePanGains(), the same as @ref LsUtils::StaticSpectraStrobeEncoder.
+ *
+ * ### Encoding a Color Track
+ *
+ * ```c++
+ *
+ * LumasonicStreamEncoder lsEncoder(LightSoundCodecs::Lumasonic);
+ * lsEncoder.reset(48000.f);
+ *
+ * lsEncoder.addKeyframe({ 0.,  0.f, 0.f, 0.f,  0.f, 0.f, 0.f });   // start from black
+ * lsEncoder.addKeyframe({ 2.,  1.f, 0.f, 0.f,  0.f, 0.f, 1.f });   // fade to red / blue over 2 seconds
+ * lsEncoder.addKeyframe({ 5.,  1.f, 0.f, 0.f,  0.f, 0.f, 1.f });   // hold
+ * lsEncoder.addKeyframe({ 5.,  0.f, 1.f, 0.f,  0.f, 1.f, 0.f });   // cut to green, smoothed by the ramp time
+ *
+ * while (!lsEncoder.isFinished())
+ * {
+ *     lsEncoder.processBlock(bufferL, bufferR, 4096);
+ *     writeToFile(bufferL, bufferR, 4096);
+ * }
+ *
+ * ```
+ *
+ * Keyframes can also be loaded from a CSV file with @ref loadKeyframesCsv().
+ *
+ * > [!NOTE]
+ * > The encoder is not thread-safe. Add keyframes and change settings from the same
+ * > thread that calls @ref processBlock().
+ */
+class LumasonicStreamEncoder
+{
+public:
+    //==============================================================================
+    /** @brief Constructor
+        @param codec                The codec to encode with.
+        @param maxLevelDb           The decibel level of a tone at 100% output.
+    */
+    explicit LumasonicStreamEncoder(LightSoundCodecs codec = LightSoundCodecs::Lumasonic, float maxLevelDb = LS_DEFAULT_REF_TONE_DB)
+        : maxGain(LsUtils::dbToGain(maxLevelDb))
+    {
+        setCodec(codec);
+    }
+
+    //==============================================================================
+    /** @brief Gets the codec the encoder encodes with.*/
+    LightSoundCodecs getCodec() const { return currentCodec; }
+
+    /** @brief Sets the codec to encode with. The tones restart at phase 0 and jump to the current colors.
+        @param codec                The codec to encode with. LightSoundCodecs::None encodes silence.
+    */
+    void setCodec(LightSoundCodecs codec)
+    {
+        currentCodec = codec;
+        bank.clearTones();
+
+        switch (codec)
+        {
+            case LightSoundCodecs::Lumasonic:
+                refTone = bank.addTone(LS_REF_TONE_FREQ);
+                colorTones[0] = bank.addTone(LS_RED_TONE_FREQ);
+                colorTones[1] = bank.addTone(LS_GREEN_TONE_FREQ);
+                colorTones[2] = bank.addTone(LS_BLUE_TONE_FREQ);
+                break;
+            case LightSoundCodecs::SpectraStrobe:
+                refTone = bank.addTone(SS_REF_TONE_FREQ);
+                colorTones[0] = bank.addTone(SS_RED_TONE_FREQ);
+                colorTones[1] = bank.addTone(SS_GREEN_TONE_FREQ);
+                colorTones[2] = bank.addTone(SS_BLUE_TONE_FREQ);
+                break;
+            case LightSoundCodecs::AudioStrobe:
+                refTone = bank.addTone(AS_TONE_FREQ);
+                colorTones[0] = colorTones[1] = colorTones[2] = -1;
+                break;
+            case LightSoundCodecs::None:
+            default:
+                refTone = colorTones[0] = colorTones[1] = colorTones[2] = -1;
+                break;
+        }
+
+        bank.reset(sampleRate);
+        lfoPhase = 0.;
+        applyGains(true);
+    }
+
+    /** @brief Gets the time in seconds a color takes to ramp over its full range (0.0 - 1.0).*/
+    double getRampTime() const { return rampTime; }
+
+    /** @brief Sets the time in seconds a color takes to ramp over its full range (0.0 - 1.0).
+        Changes between keyframes that are faster than this are slowed down to it. Use 0 to follow the keyframes exactly.
+        @param seconds              The new ramp time in seconds. The default is 5 ms.
+    */
+    void setRampTime(double seconds) { rampTime = seconds > 0. ? seconds : 0.; }
+
+    /** @brief Resets the encoder to the start of the stream with the given sample rate. Keyframes are kept.
+        @param newSampleRate        The sample rate to encode at.
+    */
+    void reset(float newSampleRate)
+    {
+        sampleRate = newSampleRate > 0.f ? (double)newSampleRate : 48000.;
+        bank.reset(sampleRate);
+        lfoPhase = 0.;
+        setTime(0.);
+    }
+
+    //==============================================================================
+    /** @brief Adds a keyframe at the end of the color track.
+        Two keyframes with the same time make a cut from the first color to the second.
+        @param keyframe             The keyframe to add.
+        @return                     True if the keyframe was added, False if its time is earlier than the last keyframe's time.
+    */
+    bool addKeyframe(const ColorKeyframe& keyframe)
+    {
+        if (keyframe.time < 0. || (!keyframes.empty() && keyframe.time < keyframes.back().time))
+            return false;
+
+        bool first = keyframes.empty();
+        keyframes.push_back(keyframe);
+
+        // Without keyframes the stream was black; start from the first color instead of fading in
+        if (first && samplePosition == 0)
+            setTime(0.);
+
+        return true;
+    }
+
+    /** @brief Adds keyframes at the end of the color track, in order.
+        @param newKeyframes         The keyframes to add.
+        @param numKeyframes         The number of keyframes to add.
+        @return                     The number of keyframes added. Adding stops at the first keyframe that is out of order.
+    */
+    int addKeyframes(const ColorKeyframe* newKeyframes, int numKeyframes)
+    {
+        int added = 0;
+
+        while (newKeyframes != nullptr && added < numKeyframes && addKeyframe(newKeyframes[added]))
+            ++added;
+
+        return added;
+    }
+
+    /** @brief Loads keyframes from a CSV file and adds them at the end of the color track.
+
+        Each line holds one keyframe: `time,r0,g0,b0,r1,g1,b1`, with the time in seconds.
+        Lines that don't hold seven numbers, such as a header line, are skipped.
+
+        @param filePath             The path of the CSV file.
+        @return                     The number of keyframes added, or -1 if the file could not be opened.
+    */
+    int loadKeyframesCsv(const char* filePath)
+    {
+        std::FILE* file = filePath != nullptr ? std::fopen(filePath, "r") : nullptr;
+
+        if (file == nullptr)
+            return -1;
+
+        int added = 0;
+        char line[512];
+
+        while (std::fgets(line, sizeof(line), file) != nullptr)
+        {
+            ColorKeyframe k {};
+
+            if (std::sscanf(line, " %lf , %f , %f , %f , %f , %f , %f", &k.time, &k.r0, &k.g0, &k.b0, &k.r1, &k.g1, &k.b1) == 7 && addKeyframe(k))
+                ++added;
+        }
+
+        std::fclose(file);
+        return added;
+    }
+
+    /** @brief Removes every keyframe. The stream fades to black.*/
+    void clearKeyframes()
+    {
+        keyframes.clear();
+        cursor = 0;
+    }
+
+    /** @brief Replaces the color track with a single color, which the stream ramps to from its current color.*/
+    void setStereoColor(float r0, float g0, float b0, float r1, float g1, float b1)
+    {
+        clearKeyframes();
+        keyframes.push_back({ 0., r0, g0, b0, r1, g1, b1 });
+    }
+
+    /** @brief Gets the number of keyframes in the color track.*/
+    int getNumKeyframes() const { return (int)keyframes.size(); }
+
+    /** @brief Gets the length of the color track in seconds (the time of the last keyframe).*/
+    double getDuration() const { return keyframes.empty() ? 0. : keyframes.back().time; }
+
+    //==============================================================================
+    /** @brief Gets the current position in the stream in seconds.*/
+    double getTime() const { return (double)samplePosition / sampleRate; }
+
+    /** @brief Moves to a position in the stream. The colors jump to the color track's value at that time.
+        @param seconds              The new position in seconds.
+    */
+    void setTime(double seconds)
+    {
+        samplePosition = seconds > 0. ? (unsigned long long)(seconds * sampleRate + .5) : 0;
+        cursor = 0;
+        colorAt(getTime(), current);
+        applyGains(true);
+    }
+
+    /** @brief Whether the position is at or past the last keyframe.*/
+    bool isFinished() const { return getTime() >= getDuration(); }
+
+    /** @brief Encodes the color track into two audio floating point buffers for a given number of samples and advances the position.
+        @param out0                 The left audio buffer to encode into.
+        @param out1                 The right audio buffer to encode into.
+        @param numSamples           The number of samples to encode into the buffers.
+        @param replace              When True, samples in the buffer will be replaced, when False encoded samples will be mixed with the existing buffer data.
+    */
+    void processBlock(float* out0, float* out1, int numSamples, bool replace = true)
+    {
+        if (out0 == nullptr || out1 == nullptr)
+            return;
+
+        for (int start = 0; start < numSamples; start += LS_STREAM_ENCODER_BLOCK)
+        {
+            const int count = numSamples - start < LS_STREAM_ENCODER_BLOCK ? numSamples - start : LS_STREAM_ENCODER_BLOCK;
+
+            samplePosition += (unsigned long long)count;
+
+            float target[6];
+            colorAt(getTime(), target);
+
+            // Limit how far each color moves in this block
+            float maxStep = rampTime > 0. ? (float)((double)count / (rampTime * sampleRate)) : 2.f;
+
+            for (int i = 0; i < 6; ++i)
+            {
+                float delta = target[i] - current[i];
+                current[i] += delta > maxStep ? maxStep : (delta < -maxStep ? -maxStep : delta);
+            }
+
+            lfoPhase = std::fmod(lfoPhase + double(M_2PI) * (double)SS_REF_PAN_LFO_FREQ * (double)count / sampleRate, double(M_2PI));
+
+            applyGains(false);
+            bank.render(out0 + start, out1 + start, count, replace);
+        }
+    }
+
+private:
+    //==============================================================================
+    // Writes the color track's value at a time to rgb (r0, g0, b0, r1, g1, b1)
+    void colorAt(double time, float* rgb)
+    {
+        if (keyframes.empty())
+        {
+            for (int i = 0; i < 6; ++i)
+                rgb[i] = 0.f;
+
+            return;
+        }
+
+        // Time only moves forward between calls to setTime(), so the cursor never steps back
+        while (cursor + 1 < keyframes.size() && keyframes[cursor + 1].time <= time)
+            ++cursor;
+
+        const auto& a = keyframes[cursor];
+        const auto& b = cursor + 1 < keyframes.size() ? keyframes[cursor + 1] : a;
+        float t = b.time > a.time && time > a.time ? (float)((time - a.time) / (b.time - a.time)) : 0.f;
+
+        const float from[6] = { a.r0, a.g0, a.b0, a.r1, a.g1, a.b1 };
+        const float to[6] = { b.r0, b.g0, b.b0, b.r1, b.g1, b.b1 };
+
+        for (int i = 0; i < 6; ++i)
+        {
+            float v = from[i] + (to[i] - from[i]) * t;
+            rgb[i] = v < 0.f ? 0.f : (v > 1.f ? 1.f : v);
+        }
+    }
+
+    // Sets the tone gains for the current colors, either right away or as ramp targets for the next render
+    void applyGains(bool immediate)
+    {
+        auto set = [this, immediate](int tone, float g0, float g1)
+        {
+            if (immediate)
+                bank.setGains(tone, g0, g1);
+            else
+                bank.setTargetGains(tone, g0, g1);
+        };
+
+        switch (currentCodec)
+        {
+            case LightSoundCodecs::Lumasonic:
+            case LightSoundCodecs::SpectraStrobe:
+            {
+                float ref0 = maxGain, ref1 = maxGain;
+
+                if (currentCodec == LightSoundCodecs::SpectraStrobe)
+                    LsUtils::spectraStrobePanGains(lfoPhase, maxGain, ref0, ref1);
+
+                set(refTone, ref0, ref1);
+
+                for (int c = 0; c < 3; ++c)
+                    set(colorTones[c], maxGain * current[c], maxGain * current[c + 3]);
+
+                break;
+            }
+            case LightSoundCodecs::AudioStrobe:
+            {
+                auto brightest = [](const float* rgb) { return rgb[0] > rgb[1] ? (rgb[0] > rgb[2] ? rgb[0] : rgb[2]) : (rgb[1] > rgb[2] ? rgb[1] : rgb[2]); };
+                set(refTone, maxGain * brightest(current), maxGain * brightest(current + 3));
+                break;
+            }
+            case LightSoundCodecs::None:
+            default:
+                break;
+        }
+    }
+
+    //==============================================================================
+    LsUtils::OscillatorBank bank;
+    LightSoundCodecs currentCodec = LightSoundCodecs::Lumasonic;
+    int refTone = -1;
+    int colorTones[3] { -1, -1, -1 };
+    const float maxGain;
+
+    double sampleRate = 48000.;
+    double rampTime = .005;
+    double lfoPhase = 0.;
+    unsigned long long samplePosition = 0;
+
+    std::vector<ColorKeyframe> keyframes;
+    size_t cursor = 0;
+    float current[6] {};    // r0, g0, b0, r1, g1, b1 as currently encoded
+};
@@ -26,6 +26,27 @@
 
 #include "LumasonicCommon.h"
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LS_UTILS_SSE2 1
+#endif
+
+// The maximum number of samples ToneGenerator::generateBlock() runs its oscillator before re-synchronizing it to the phase accumulator
+#ifndef LS_TONE_RESYNC_INTERVAL
+#define LS_TONE_RESYNC_INTERVAL     1024
+#endif
+
+// The maximum number of tones in one LsUtils::OscillatorBank
+#define LS_OSC_BANK_MAX_TONES       8
+
+// The number of samples over which the static SpectraStrobe and AudioStrobe encoders ramp to a
+// new color, and between updates of the SpectraStrobe reference pan gains
+#ifndef LS_ENCODER_UPDATE_INTERVAL
+#define LS_ENCODER_UPDATE_INTERVAL  32
+#endif
 
 // 2 * PI
 #ifndef M_2PI
@@ -93,6 +114,272 @@ namespace LsUtils
         return true;
     }
 
+    /** @brief De-interleaves one pair of adjacent channels of 32-bit PCM float audio from an interleaved buffer with any number of channels.
+
+        This is the building block of the other float de-interleave functions. With SSE2 it moves four frames
+        per step: the two samples of the pair are loaded together from each frame and split with one shuffle.
+
+        ```c++
+
+        // A 10 channel interface, decoding the stereo pair on inputs 5 and 6
+        LsUtils::deinterleaveChannelPair(input, 10, 4, left, right, numFrames);
+
+        ```
+
+        @param input                The interleaved audio samples, numChannels samples per frame.
+        @param numChannels          The number of interleaved channels in the input (at least 2).
+        @param firstChannel         The index of the first channel of the pair, from 0 to numChannels - 2.
+        @param outL                 The pointer to the buffer that will contain the samples of channel firstChannel.
+        @param outR                 The pointer to the buffer that will contain the samples of channel firstChannel + 1.
+        @param samplesPerChannel    The number of frames (samples per channel) to de-interleave.
+        @return                     True if the process was successful, False it not.
+    */
+    inline bool deinterleaveChannelPair(const float* input, int numChannels, int firstChannel, float* outL, float* outR, int samplesPerChannel)
+    {
+        if (input == nullptr || outL == nullptr || outR == nullptr || samplesPerChannel <= 0
+            || numChannels < 2 || firstChannel < 0 || firstChannel > numChannels - 2)
+            return false;
+
+        const float* in = input + firstChannel;
+        const size_t stride = (size_t)numChannels;
+        int s = 0;
+
+#if LS_UTILS_SSE2
+        if (numChannels == 2)
+        {
+            for (; s + 4 <= samplesPerChannel; s += 4, in += 8)
+            {
+                __m128 a = _mm_loadu_ps(in);
+                __m128 b = _mm_loadu_ps(in + 4);
+                _mm_storeu_ps(outL + s, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(outR + s, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+        }
+        else
+        {
+            for (; s + 4 <= samplesPerChannel; s += 4, in += 4 * stride)
+            {
+                // Each 64-bit load picks up the L/R pair of one frame
+                __m128 a = _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double*)in)), (const __m64*)(in + stride));
+                __m128 b = _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double*)(in + 2 * stride))), (const __m64*)(in + 3 * stride));
+                _mm_storeu_ps(outL + s, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(outR + s, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+        }
+#endif
+
+        for (; s < samplesPerChannel; ++s, in += stride)
+        {
+            outL[s] = in[0];
+            outR[s] = in[1];
+        }
+
+        return true;
+    }
+
+    /** @brief De-interleaves 32-bit PCM float audio from a single interleaved stereo buffer into two separate left and right channel buffers of half the size.
+        This overload is picked for float buffers and runs the SIMD path of @ref deinterleaveChannelPair().
+        @param input                The left/right interleaved stereo audio samples.
+        @param outL                 The pointer to the buffer that will contained the de-interleaved left samples.
+        @param outR                 The pointer to the buffer that will contained the de-interleaved right samples.
+        @param samplesPerChannel    The total number of de-interleaved audio samples per channel (for stereo this is half of the total interleaved samples of the input).
+        @return                     True if the process was successful, False it not.
+    */
+    inline bool deinterleaveStereoAudio(const float* input, float* outL, float* outR, int samplesPerChannel)
+    {
+        return deinterleaveChannelPair(input, 2, 0, outL, outR, samplesPerChannel);
+    }
+
+    /** @brief De-interleaves 32-bit PCM float audio with any number of channels into separate channel buffers.
+        @param input                The interleaved audio samples, numChannels samples per frame.
+        @param numChannels          The number of interleaved channels in the input.
+        @param outputs              An array of numChannels channel buffers. A nullptr entry skips that channel.
+        @param samplesPerChannel    The number of frames (samples per channel) to de-interleave.
+        @return                     True if the process was successful, False it not.
+    */
+    inline bool deinterleaveAudio(const float* input, int numChannels, float* const* outputs, int samplesPerChannel)
+    {
+        if (input == nullptr || outputs == nullptr || numChannels <= 0 || samplesPerChannel <= 0)
+            return false;
+
+        int c = 0;
+
+        // Wanted channels are taken two at a time; a lone channel falls back to a strided copy
+        while (c < numChannels)
+        {
+            if (outputs[c] == nullptr)
+            {
+                ++c;
+                continue;
+            }
+
+            if (c + 1 < numChannels && outputs[c + 1] != nullptr)
+            {
+                deinterleaveChannelPair(input, numChannels, c, outputs[c], outputs[c + 1], samplesPerChannel);
+                c += 2;
+                continue;
+            }
+
+            const float* in = input + c;
+            float* out = outputs[c];
+
+            for (int s = 0; s < samplesPerChannel; ++s, in += numChannels)
+                out[s] = *in;
+
+            ++c;
+        }
+
+        return true;
+    }
+
+    /** @brief Interleaves separate 32-bit PCM float channel buffers into a single buffer with any number of channels.
+        This is the inverse of @ref deinterleaveAudio().
+        @param inputs               An array of numChannels channel buffers. A nullptr entry writes silence to that channel.
+        @param numChannels          The number of channels to interleave.
+        @param output               The buffer that will contain the interleaved samples (numChannels * samplesPerChannel samples).
+        @param samplesPerChannel    The number of frames (samples per channel) to interleave.
+        @return                     True if the process was successful, False it not.
+    */
+    inline bool interleaveAudio(const float* const* inputs, int numChannels, float* output, int samplesPerChannel)
+    {
+        if (inputs == nullptr || output == nullptr || numChannels <= 0 || samplesPerChannel <= 0)
+            return false;
+
+        const size_t stride = (size_t)numChannels;
+        int c = 0;
+
+        while (c < numChannels)
+        {
+            const float* inL = inputs[c];
+            const float* inR = c + 1 < numChannels ? inputs[c + 1] : nullptr;
+            float* out = output + c;
+            int s = 0;
+
+            if (inL == nullptr || inR == nullptr)
+            {
+                for (; s < samplesPerChannel; ++s, out += stride)
+                    *out = inL != nullptr ? inL[s] : 0.f;
+
+                ++c;
+                continue;
+            }
+
+#if LS_UTILS_SSE2
+            for (; s + 4 <= samplesPerChannel; s += 4, out += 4 * stride)
+            {
+                __m128 l = _mm_loadu_ps(inL + s);
+                __m128 r = _mm_loadu_ps(inR + s);
+                __m128 lo = _mm_unpacklo_ps(l, r);     // L0 R0 L1 R1
+                __m128 hi = _mm_unpackhi_ps(l, r);     // L2 R2 L3 R3
+
+                if (numChannels == 2)
+                {
+                    _mm_storeu_ps(out, lo);
+                    _mm_storeu_ps(out + 4, hi);
+                }
+                else
+                {
+                    _mm_storel_pi((__m64*)out, lo);
+                    _mm_storeh_pi((__m64*)(out + stride), lo);
+                    _mm_storel_pi((__m64*)(out + 2 * stride), hi);
+                    _mm_storeh_pi((__m64*)(out + 3 * stride), hi);
+                }
+            }
+#endif
+
+            for (; s < samplesPerChannel; ++s, out += stride)
+            {
+                out[0] = inL[s];
+                out[1] = inR[s];
+            }
+
+            c += 2;
+        }
+
+        return true;
+    }
+
+    /** @brief De-interleaves one pair of adjacent channels of 16-bit signed PCM audio into float buffers (-1.0 - 1.0).
+        @param input                The interleaved 16-bit samples, numChannels samples per frame.
+        @param numChannels          The number of interleaved channels in the input (at least 2).
+        @param firstChannel         The index of the first channel of the pair, from 0 to numChannels - 2.
+        @param outL                 The pointer to the buffer that will contain the samples of channel firstChannel.
+        @param outR                 The pointer to the buffer that will contain the samples of channel firstChannel + 1.
+        @param samplesPerChannel    The number of frames (samples per channel) to convert.
+        @return                     True if the process was successful, False it not.
+    */
+    inline bool deinterleaveChannelPairInt16(const int16_t* input, int numChannels, int firstChannel, float* outL, float* outR, int samplesPerChannel)
+    {
+        if (input == nullptr || outL == nullptr || outR == nullptr || samplesPerChannel <= 0
+            || numChannels < 2 || firstChannel < 0 || firstChannel > numChannels - 2)
+            return false;
+
+        const int16_t* in = input + firstChannel;
+        const size_t stride = (size_t)numChannels;
+        const float scale = 1.f / 32768.f;
+        int s = 0;
+
+#if LS_UTILS_SSE2
+        const __m128 vScale = _mm_set1_ps(scale);
+
+        for (; s + 4 <= samplesPerChannel; s += 4, in += 4 * stride)
+        {
+            // One 32-bit word per frame holds the L sample (low half) and R sample (high half)
+            int32_t w[4];
+            for (int f = 0; f < 4; ++f)
+                std::memcpy(&w[f], in + f * stride, sizeof(int32_t));
+
+            __m128i v = _mm_loadu_si128((const __m128i*)w);
+            __m128i l = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+            __m128i r = _mm_srai_epi32(v, 16);
+            _mm_storeu_ps(outL + s, _mm_mul_ps(_mm_cvtepi32_ps(l), vScale));
+            _mm_storeu_ps(outR + s, _mm_mul_ps(_mm_cvtepi32_ps(r), vScale));
+        }
+#endif
+
+        for (; s < samplesPerChannel; ++s, in += stride)
+        {
+            outL[s] = (float)in[0] * scale;
+            outR[s] = (float)in[1] * scale;
+        }
+
+        return true;
+    }
+
+    /** @brief De-interleaves one pair of adjacent channels of packed 24-bit signed little-endian PCM audio (3 bytes per sample) into float buffers (-1.0 - 1.0).
+        @param input                The interleaved packed 24-bit samples, numChannels * 3 bytes per frame.
+        @param numChannels          The number of interleaved channels in the input (at least 2).
+        @param firstChannel         The index of the first channel of the pair, from 0 to numChannels - 2.
+        @param outL                 The pointer to the buffer that will contain the samples of channel firstChannel.
+        @param outR                 The pointer to the buffer that will contain the samples of channel firstChannel + 1.
+        @param samplesPerChannel    The number of frames (samples per channel) to convert.
+        @return                     True if the process was successful, False it not.
+    */
+    inline bool deinterleaveChannelPairInt24(const unsigned char* input, int numChannels, int firstChannel, float* outL, float* outR, int samplesPerChannel)
+    {
+        if (input == nullptr || outL == nullptr || outR == nullptr || samplesPerChannel <= 0
+            || numChannels < 2 || firstChannel < 0 || firstChannel > numChannels - 2)
+            return false;
+
+        const unsigned char* in = input + (size_t)firstChannel * 3;
+        const size_t stride = (size_t)numChannels * 3;
+        const float scale = 1.f / 8388608.f;
+
+        // Shifting the 3 bytes into the top of an int and back sign-extends them
+        auto load = [](const unsigned char* p)
+        {
+            return (int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24)) >> 8;
+        };
+
+        for (int s = 0; s < samplesPerChannel; ++s, in += stride)
+        {
+            outL[s] = (float)load(in) * scale;
+            outR[s] = (float)load(in + 3) * scale;
+        }
+
+        return true;
+    }
+
     /** @brief De-interleaves 32-bit PCM float audio from a single interleaved stereo buffer into four separate channel buffers 1/4th the size of the input.
         @param input                The interleaved four channel audio sample buffer.
         @param out0                 The pointer to channel 0's de-interleaved sample buffer.
@@ -122,6 +409,20 @@ namespace LsUtils
         return true;
     }
 
+    //==============================================================================
+    /** @brief Wraps a phase in radians into the range 0 - 2 pi, for oscillators that keep their own phase accumulator.
+        @param phase                The phase to wrap, in radians. Any finite value is accepted.
+        @return                     The same phase, from 0 (inclusive) to 2 pi (exclusive).
+    */
+    inline double wrapPhase(double phase)
+    {
+        if (phase >= 0. && phase < double(M_2PI))
+            return phase;
+
+        phase = std::fmod(phase, double(M_2PI));
+        return phase < 0. ? phase + double(M_2PI) : phase;
+    }
+
     //==============================================================================
     /**
      * @brief Utility class for generating a sine wave tone at a given
@@ -164,6 +465,28 @@ namespace LsUtils
      * 
      * ```
      * 
+     * ### Generating Blocks of Samples
+     * 
+     * To fill a whole buffer at once, use the `generateBlock()` method. It replaces the
+     * per-sample `std::sin()` call with a recursive quadrature oscillator, which rotates
+     * a (cos, sin) pair by the phase increment with four multiplies per sample:
+     * 
+     * ```c++
+     * 
+     * tone.generateBlock(buffer, numSamples);          // overwrite the buffer with the tone
+     * tone.generateBlock(buffer, numSamples, false);   // mix the tone into the buffer
+     * 
+     * ```
+     * 
+     * The oscillator is re-synchronized to the phase accumulator with one `std::sin()`
+     * and `std::cos()` call every @ref LS_TONE_RESYNC_INTERVAL samples, so its rounding
+     * error never builds up. Between re-syncs the phase and amplitude error stays below
+     * 1e-12 (about -240 dB), far below the resolution of 32 bit float output.
+     * 
+     * The phase accumulator is wrapped to the range 0 - 2 pi by both `nextSample()` and
+     * `generateBlock()`, so generators that run for days keep the same phase precision
+     * as they had at the start, and both methods can be mixed on the same generator.
+     * 
      */
     class ToneGenerator
     {
@@ -210,24 +533,335 @@ namespace LsUtils
         inline double nextSample()
         {
             double sample = amplitude * std::sin(currentPhase);
-            currentPhase += phasePerSample;
+            currentPhase = wrapPhase(currentPhase + phasePerSample);
             return sample;
         }
 
+        /** @brief Generates the next samples of the tone into a buffer using the recursive quadrature oscillator.
+            @param output       The buffer to write the samples to.
+            @param numSamples   The number of samples to generate.
+            @param replace      When True, samples in the buffer will be replaced, when False the tone will be mixed with the existing buffer data.
+        */
+        void generateBlock(float* output, int numSamples, bool replace = true)
+        {
+            if (output == nullptr || numSamples <= 0)
+                return;
+
+            // A silent tone only needs its phase advanced
+            if (amplitude == 0.)
+            {
+                if (replace)
+                    std::memset(output, 0, sizeof(float) * (size_t)numSamples);
+
+                currentPhase = wrapPhase(currentPhase + phasePerSample * (double)numSamples);
+                return;
+            }
+
+            const double rotCos = std::cos(phasePerSample);
+            const double rotSin = std::sin(phasePerSample);
+
+            for (int start = 0; start < numSamples; start += LS_TONE_RESYNC_INTERVAL)
+            {
+                const int count = numSamples - start < LS_TONE_RESYNC_INTERVAL ? numSamples - start : LS_TONE_RESYNC_INTERVAL;
+                double c = std::cos(currentPhase);
+                double s = std::sin(currentPhase);
+                float* out = output + start;
+
+                for (int i = 0; i < count; ++i)
+                {
+                    auto sample = (float)(amplitude * s);
+                    out[i] = replace ? sample : out[i] + sample;
+
+                    double nextC = c * rotCos - s * rotSin;
+                    s = s * rotCos + c * rotSin;
+                    c = nextC;
+                }
+
+                // Advance the accumulator in one step so it carries a single rounding per chunk
+                currentPhase = wrapPhase(currentPhase + phasePerSample * (double)count);
+            }
+        }
+
         /** @brief Sets the phase of the waveform using a 0.0 - 1.0 normalized value.
         *   @param phase    The new phase to set (0.0 - 1.0)
         */
         inline void setPhase(double phase)
         {
-            currentPhase = phase * double(M_2PI);
+            currentPhase = wrapPhase(phase * double(M_2PI));
         }
 
+        /** @brief Gets the phase of the next sample as a 0.0 - 1.0 normalized value. */
+        inline double getPhase() const { return currentPhase / double(M_2PI); }
+
     private:
-        double frequency;
-        double sampleRate;
-        double currentPhase;
-        double phasePerSample;
-        double amplitude;
+        double frequency = 1.;
+        double sampleRate = 48000.;
+        double currentPhase = 0.;
+        double phasePerSample = 0.;
+        double amplitude = 0.;
+    };
+
+    //==============================================================================
+    /**
+     * @brief A bank of sine oscillators rendered together into a stereo pair of buffers,
+     * with a separately ramped gain for each tone in each channel.
+     * 
+     * @details
+     * This is the oscillator core shared by the encoders. Each tone is a recursive
+     * quadrature oscillator like the one of @ref ToneGenerator::generateBlock(), kept in
+     * double precision and re-synchronized to its phase accumulator every
+     * @ref LS_TONE_RESYNC_INTERVAL samples. With SSE2, two tones are advanced per
+     * instruction.
+     * 
+     * Since each tone has its own left and right gain, a tone that is present in both
+     * channels (such as the red tone of the left and right Lumasonic channels) only
+     * needs one oscillator.
+     * 
+     * ```c++
+     * 
+     * LsUtils::OscillatorBank bank;
+     * bank.reset(48000.);
+     * 
+     * int ref = bank.addTone(LS_REF_TONE_FREQ);
+     * bank.setGains(ref, .025f, .025f);
+     * 
+     * bank.setTargetGains(ref, 0.f, .025f);        // fades the left channel out over the next call
+     * bank.render(bufferL, bufferR, numSamples);
+     * 
+     * ```
+     */
+    class OscillatorBank
+    {
+    public:
+        /** @brief Constructor*/
+        OscillatorBank() { clearTones(); }
+
+        /** @brief Sets the sample rate and resets the phase of every tone to 0.
+            @param newSampleRate    The sample rate to use.
+        */
+        void reset(double newSampleRate)
+        {
+            sampleRate = newSampleRate > 0. ? newSampleRate : 48000.;
+
+            for (int t = 0; t < numTones; ++t)
+            {
+                phase[t] = 0.;
+                setFrequency(t, frequency[t]);
+            }
+
+            samplesSinceSync = 0;
+        }
+
+        /** @brief Removes every tone.*/
+        void clearTones()
+        {
+            numTones = 0;
+            samplesSinceSync = 0;
+
+            for (int t = 0; t < LS_OSC_BANK_MAX_TONES; ++t)
+            {
+                frequency[t] = phase[t] = increment[t] = 0.;
+                c[t] = s[t] = 0.;
+                rotCos[t] = 1.;
+                rotSin[t] = 0.;
+                gain0[t] = gain1[t] = target0[t] = target1[t] = 0.;
+            }
+        }
+
+        /** @brief Adds a tone with a gain of 0 in both channels.
+            @param frequencyHz      The frequency of the tone in Hz.
+            @return                 The index of the tone, or -1 if the bank is full.
+        */
+        int addTone(double frequencyHz)
+        {
+            if (numTones >= LS_OSC_BANK_MAX_TONES)
+                return -1;
+
+            int t = numTones++;
+            phase[t] = 0.;
+            setFrequency(t, frequencyHz);
+            samplesSinceSync = 0;
+            return t;
+        }
+
+        /** @brief Gets the number of tones in the bank.*/
+        int getNumTones() const { return numTones; }
+
+        /** @brief Sets the frequency of a tone.
+            @param tone             The index of the tone.
+            @param frequencyHz      The new frequency in Hz.
+        */
+        void setFrequency(int tone, double frequencyHz)
+        {
+            if (tone < 0 || tone >= numTones)
+                return;
+
+            frequency[tone] = frequencyHz;
+            increment[tone] = double(M_2PI) * frequencyHz / sampleRate;
+            rotCos[tone] = std::cos(increment[tone]);
+            rotSin[tone] = std::sin(increment[tone]);
+            samplesSinceSync = 0;
+        }
+
+        /** @brief Sets the phase of a tone using a 0.0 - 1.0 normalized value.*/
+        void setPhase(int tone, double normalizedPhase)
+        {
+            if (tone < 0 || tone >= numTones)
+                return;
+
+            phase[tone] = wrapPhase(normalizedPhase * double(M_2PI));
+            samplesSinceSync = 0;
+        }
+
+        /** @brief Sets the left and right gain of a tone right away, with no ramp.*/
+        void setGains(int tone, float newGain0, float newGain1)
+        {
+            if (tone < 0 || tone >= numTones)
+                return;
+
+            gain0[tone] = target0[tone] = (double)newGain0;
+            gain1[tone] = target1[tone] = (double)newGain1;
+        }
+
+        /** @brief Sets the left and right gain a tone ramps to, linearly over the next call to @ref render().*/
+        void setTargetGains(int tone, float newGain0, float newGain1)
+        {
+            if (tone < 0 || tone >= numTones)
+                return;
+
+            target0[tone] = (double)newGain0;
+            target1[tone] = (double)newGain1;
+        }
+
+        /** @brief Renders the sum of all tones into a stereo pair of buffers.
+            @param out0             The left audio buffer to render into.
+            @param out1             The right audio buffer to render into.
+            @param numSamples       The number of samples to render.
+            @param replace          When True, samples in the buffers will be replaced, when False the tones will be mixed with the existing buffer data.
+        */
+        void render(float* out0, float* out1, int numSamples, bool replace = true)
+        {
+            if (out0 == nullptr || out1 == nullptr || numSamples <= 0)
+                return;
+
+            alignas(16) double step0[LS_OSC_BANK_MAX_TONES];
+            alignas(16) double step1[LS_OSC_BANK_MAX_TONES];
+
+            for (int t = 0; t < LS_OSC_BANK_MAX_TONES; ++t)
+            {
+                step0[t] = (target0[t] - gain0[t]) / (double)numSamples;
+                step1[t] = (target1[t] - gain1[t]) / (double)numSamples;
+            }
+
+            // The re-sync interval runs across calls, so short calls (such as automation
+            // blocks) don't pay for a sin() and cos() per tone each time
+            for (int start = 0; start < numSamples;)
+            {
+                if (samplesSinceSync == 0)
+                {
+                    for (int t = 0; t < numTones; ++t)
+                    {
+                        c[t] = std::cos(phase[t]);
+                        s[t] = std::sin(phase[t]);
+                    }
+                }
+
+                int count = LS_TONE_RESYNC_INTERVAL - samplesSinceSync;
+                count = numSamples - start < count ? numSamples - start : count;
+
+                renderChunk(out0 + start, out1 + start, count, replace, step0, step1);
+
+                for (int t = 0; t < numTones; ++t)
+                    phase[t] = wrapPhase(phase[t] + increment[t] * (double)count);
+
+                samplesSinceSync = (samplesSinceSync + count) % LS_TONE_RESYNC_INTERVAL;
+                start += count;
+            }
+
+            // Land exactly on the targets, whatever the rounding of the ramp
+            for (int t = 0; t < LS_OSC_BANK_MAX_TONES; ++t)
+            {
+                gain0[t] = target0[t];
+                gain1[t] = target1[t];
+            }
+        }
+
+    private:
+        //==============================================================================
+        void renderChunk(float* out0, float* out1, int count, bool replace, const double* step0, const double* step1)
+        {
+            const int numPairs = (numTones + 1) / 2;
+
+#if LS_UTILS_SSE2
+            for (int i = 0; i < count; ++i)
+            {
+                __m128d acc0 = _mm_setzero_pd();
+                __m128d acc1 = _mm_setzero_pd();
+
+                for (int p = 0; p < numPairs * 2; p += 2)
+                {
+                    __m128d vc = _mm_load_pd(c + p);
+                    __m128d vs = _mm_load_pd(s + p);
+                    __m128d g0 = _mm_load_pd(gain0 + p);
+                    __m128d g1 = _mm_load_pd(gain1 + p);
+
+                    acc0 = _mm_add_pd(acc0, _mm_mul_pd(vs, g0));
+                    acc1 = _mm_add_pd(acc1, _mm_mul_pd(vs, g1));
+
+                    _mm_store_pd(gain0 + p, _mm_add_pd(g0, _mm_load_pd(step0 + p)));
+                    _mm_store_pd(gain1 + p, _mm_add_pd(g1, _mm_load_pd(step1 + p)));
+
+                    __m128d rc = _mm_load_pd(rotCos + p);
+                    __m128d rs = _mm_load_pd(rotSin + p);
+                    _mm_store_pd(c + p, _mm_sub_pd(_mm_mul_pd(vc, rc), _mm_mul_pd(vs, rs)));
+                    _mm_store_pd(s + p, _mm_add_pd(_mm_mul_pd(vs, rc), _mm_mul_pd(vc, rs)));
+                }
+
+                auto l = (float)_mm_cvtsd_f64(_mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0)));
+                auto r = (float)_mm_cvtsd_f64(_mm_add_sd(acc1, _mm_unpackhi_pd(acc1, acc1)));
+                out0[i] = replace ? l : out0[i] + l;
+                out1[i] = replace ? r : out1[i] + r;
+            }
+#else
+            for (int i = 0; i < count; ++i)
+            {
+                double l = 0., r = 0.;
+
+                for (int t = 0; t < numPairs * 2; ++t)
+                {
+                    l += s[t] * gain0[t];
+                    r += s[t] * gain1[t];
+                    gain0[t] += step0[t];
+                    gain1[t] += step1[t];
+
+                    double nextC = c[t] * rotCos[t] - s[t] * rotSin[t];
+                    s[t] = s[t] * rotCos[t] + c[t] * rotSin[t];
+                    c[t] = nextC;
+                }
+
+                out0[i] = replace ? (float)l : out0[i] + (float)l;
+                out1[i] = replace ? (float)r : out1[i] + (float)r;
+            }
+#endif
+        }
+
+        //==============================================================================
+        // Structure of arrays, so pairs of tones load straight into SSE registers.
+        // Unused tones keep a gain of 0 and rotate (0, 0), so odd counts need no special case.
+        alignas(16) double c[LS_OSC_BANK_MAX_TONES];
+        alignas(16) double s[LS_OSC_BANK_MAX_TONES];
+        alignas(16) double rotCos[LS_OSC_BANK_MAX_TONES];
+        alignas(16) double rotSin[LS_OSC_BANK_MAX_TONES];
+        alignas(16) double gain0[LS_OSC_BANK_MAX_TONES];
+        alignas(16) double gain1[LS_OSC_BANK_MAX_TONES];
+        double target0[LS_OSC_BANK_MAX_TONES];
+        double target1[LS_OSC_BANK_MAX_TONES];
+        double frequency[LS_OSC_BANK_MAX_TONES];
+        double phase[LS_OSC_BANK_MAX_TONES];
+        double increment[LS_OSC_BANK_MAX_TONES];
+        double sampleRate = 48000.;
+        int numTones = 0;
+        int samplesSinceSync = 0;   // 0 re-syncs the oscillators to the phase accumulators on the next render
     };
 
     //==============================================================================
@@ -362,29 +996,26 @@ namespace LsUtils
         */
         void processBlock(float* in0, float* in1, int numSamples, bool replace = true)
         {
-            if (replace)
-            {
-                for (int i = 0; i < numSamples; ++i)
-                {
-                    auto f  = toneF.nextSample();
-                    auto r0 = toneR0.nextSample();  auto r1 = toneR1.nextSample();
-                    auto g0 = toneG0.nextSample();  auto g1 = toneG1.nextSample();
-                    auto b0 = toneB0.nextSample();  auto b1 = toneB1.nextSample();
-                    in0[i] = (float)(f + r0 + g0 + b0);
-                    in1[i] = (float)(f + r1 + g1 + b1);
-                }
-            }
-            else
+            // The reference tone is shared by both channels, so it is generated once per chunk
+            float ref[256];
+
+            for (int start = 0; start < numSamples; start += 256)
             {
-                for (int i = 0; i < numSamples; ++i)
+                const int count = numSamples - start < 256 ? numSamples - start : 256;
+                float* out0 = in0 + start;
+                float* out1 = in1 + start;
+
+                toneF.generateBlock(ref, count);
+
+                for (int i = 0; i < count; ++i)
                 {
-                    auto f  = toneF.nextSample();
-                    auto r0 = toneR0.nextSample();  auto r1 = toneR1.nextSample();
-                    auto g0 = toneG0.nextSample();  auto g1 = toneG1.nextSample();
-                    auto b0 = toneB0.nextSample();  auto b1 = toneB1.nextSample();
-                    in0[i] += (float)(f + r0 + g0 + b0);
-                    in1[i] += (float)(f + r1 + g1 + b1);
+                    out0[i] = replace ? ref[i] : out0[i] + ref[i];
+                    out1[i] = replace ? ref[i] : out1[i] + ref[i];
                 }
+
+                toneR0.generateBlock(out0, count, false);   toneR1.generateBlock(out1, count, false);
+                toneG0.generateBlock(out0, count, false);   toneG1.generateBlock(out1, count, false);
+                toneB0.generateBlock(out0, count, false);   toneB1.generateBlock(out1, count, false);
             }
         }
 
@@ -399,6 +1030,202 @@ namespace LsUtils
         ToneGenerator toneB1;               // right blue tone
     };
 
+    //==============================================================================
+    /** @brief Gets the left and right gain of the SpectraStrobe reference tone at a point of its pan LFO.
+
+        The reference sweeps fully left and right once per LFO cycle (@ref SS_REF_PAN_LFO_FREQ),
+        with an equal-power pan law so its total power stays constant.
+
+        @param lfoPhase             The phase of the pan LFO in radians.
+        @param gain                 The full gain of the reference tone. Centered, each channel gets gain * 0.707.
+        @param gain0                Receives the left gain.
+        @param gain1                Receives the right gain.
+    */
+    inline void spectraStrobePanGains(double lfoPhase, float gain, float& gain0, float& gain1)
+    {
+        double angle = double(M_2PI) / 8. * (1. + std::sin(lfoPhase));
+        gain0 = (float)((double)gain * std::cos(angle));
+        gain1 = (float)((double)gain * std::sin(angle));
+    }
+
+    //==============================================================================
+    /**
+     * @brief A utility class for generating static SpectraStrobe signals.
+     * 
+     * @details
+     * The SpectraStrobe counterpart of @ref StaticLumasonicEncoder, with the same
+     * methods. It generates the SpectraStrobe reference, red, green and blue tones
+     * (SS_*_FREQ), with the reference panned left and right by the
+     * @ref SS_REF_PAN_LFO_FREQ LFO (see @ref spectraStrobePanGains()).
+     * 
+     * The pan gains are updated every @ref LS_ENCODER_UPDATE_INTERVAL samples and
+     * ramp linearly in between. New colors ramp in over the first
+     * @ref LS_ENCODER_UPDATE_INTERVAL samples after they are set, so changing colors
+     * does not step the carriers, however long the processBlock() calls are.
+     * 
+     * ```c++
+     * 
+     * LsUtils::StaticSpectraStrobeEncoder ssEncoder;
+     * ssEncoder.reset(48000.f);
+     * ssEncoder.setStereoColor(1.0f, 0.5f, 0.25f, 0.5f, 0.25f, 0.125f);
+     * ssEncoder.processBlock(bufferL, bufferR, numSamples);
+     * 
+     * ```
+     */
+    class StaticSpectraStrobeEncoder
+    {
+    public:
+        /** @brief Constructor
+            @param maxLevelDb       Sets the decibel level that equals 100% output for the encoder's carrier tones.
+        */
+        StaticSpectraStrobeEncoder(float maxLevelDb = LS_DEFAULT_REF_TONE_DB)
+            : maxGain(dbToGain(maxLevelDb))
+        {
+            toneF = bank.addTone(SS_REF_TONE_FREQ);     // panned reference tone
+            toneR = bank.addTone(SS_RED_TONE_FREQ);     // left & right red
+            toneG = bank.addTone(SS_GREEN_TONE_FREQ);   // left & right green
+            toneB = bank.addTone(SS_BLUE_TONE_FREQ);    // left & right blue
+
+            float g0, g1;
+            spectraStrobePanGains(0., maxGain, g0, g1);
+            bank.setGains(toneF, g0, g1);
+        }
+
+        /** @brief Sets the current stereo color values of the encoder. The tone levels ramp to the new values over the next @ref LS_ENCODER_UPDATE_INTERVAL samples.
+            @param r0               The left red channel value.
+            @param g0               The left green channel value.
+            @param b0               The left blue channel value.
+            @param r1               The right red channel value.
+            @param g1               The right green channel value.
+            @param b1               The right blue channel value.
+        */
+        void setStereoColor(float r0, float g0, float b0, float r1, float g1, float b1)
+        {
+            bank.setTargetGains(toneR, maxGain * r0, maxGain * r1);
+            bank.setTargetGains(toneG, maxGain * g0, maxGain * g1);
+            bank.setTargetGains(toneB, maxGain * b0, maxGain * b1);
+        }
+
+        /** @brief Resets the static encoder with the given sample rate.
+            @param sampleRate       The sample rate to reset the encoder to.
+        */
+        void reset(float sampleRate)
+        {
+            rate = sampleRate > 0.f ? (double)sampleRate : 48000.;
+            bank.reset(rate);
+            lfoPhase = 0.;
+
+            float g0, g1;
+            spectraStrobePanGains(0., maxGain, g0, g1);
+            bank.setGains(toneF, g0, g1);
+        }
+
+        /** @brief Encodes the current stereo color values to two audio floating point buffers for a given number of samples.
+            @param in0              The left audio buffer to encode into.
+            @param in1              The right audio buffer to encode into.
+            @param numSamples       The number of samples to encode into the buffers.
+            @param replace          When True, samples in the buffer will be replaced, when False encoded samples will be mixed with the existing buffer data.
+        */
+        void processBlock(float* in0, float* in1, int numSamples, bool replace = true)
+        {
+            for (int start = 0; start < numSamples; start += LS_ENCODER_UPDATE_INTERVAL)
+            {
+                const int count = numSamples - start < LS_ENCODER_UPDATE_INTERVAL ? numSamples - start : LS_ENCODER_UPDATE_INTERVAL;
+
+                lfoPhase = std::fmod(lfoPhase + double(M_2PI) * (double)SS_REF_PAN_LFO_FREQ * (double)count / rate, double(M_2PI));
+
+                float g0, g1;
+                spectraStrobePanGains(lfoPhase, maxGain, g0, g1);
+                bank.setTargetGains(toneF, g0, g1);
+
+                bank.render(in0 + start, in1 + start, count, replace);
+            }
+        }
+
+    private:
+        OscillatorBank bank;                // the reference and color tones
+        int toneF, toneR, toneG, toneB;     // the index of each tone in the bank
+        const float maxGain;
+        double rate = 48000.;
+        double lfoPhase = 0.;
+    };
+
+    //==============================================================================
+    /**
+     * @brief A utility class for generating static AudioStrobe signals.
+     * 
+     * @details
+     * The AudioStrobe counterpart of @ref StaticLumasonicEncoder, with the same
+     * methods. AudioStrobe has a single @ref AS_TONE_FREQ tone per channel whose
+     * level sets the brightness of that side, so each channel is encoded at the
+     * level of its brightest red, green or blue value. New levels ramp in over the
+     * first @ref LS_ENCODER_UPDATE_INTERVAL samples after they are set.
+     * 
+     * ```c++
+     * 
+     * LsUtils::StaticAudioStrobeEncoder asEncoder;
+     * asEncoder.reset(48000.f);
+     * asEncoder.setStereoColor(1.0f, 1.0f, 1.0f, 0.5f, 0.5f, 0.5f);  // left at full, right at half brightness
+     * asEncoder.processBlock(bufferL, bufferR, numSamples);
+     * 
+     * ```
+     */
+    class StaticAudioStrobeEncoder
+    {
+    public:
+        /** @brief Constructor
+            @param maxLevelDb       Sets the decibel level that equals 100% output for the encoder's carrier tone.
+        */
+        StaticAudioStrobeEncoder(float maxLevelDb = LS_DEFAULT_REF_TONE_DB)
+            : maxGain(dbToGain(maxLevelDb))
+        {
+            tone = bank.addTone(AS_TONE_FREQ);
+        }
+
+        /** @brief Sets the current stereo color values of the encoder. The tone levels ramp to the new values over the next @ref LS_ENCODER_UPDATE_INTERVAL samples.
+            @param r0               The left red channel value.
+            @param g0               The left green channel value.
+            @param b0               The left blue channel value.
+            @param r1               The right red channel value.
+            @param g1               The right green channel value.
+            @param b1               The right blue channel value.
+        */
+        void setStereoColor(float r0, float g0, float b0, float r1, float g1, float b1)
+        {
+            auto brightest = [](float r, float g, float b) { return r > g ? (r > b ? r : b) : (g > b ? g : b); };
+            bank.setTargetGains(tone, maxGain * brightest(r0, g0, b0), maxGain * brightest(r1, g1, b1));
+        }
+
+        /** @brief Resets the static encoder with the given sample rate.
+            @param sampleRate       The sample rate to reset the encoder to.
+        */
+        void reset(float sampleRate)
+        {
+            bank.reset((double)sampleRate);
+        }
+
+        /** @brief Encodes the current stereo color values to two audio floating point buffers for a given number of samples.
+            @param in0              The left audio buffer to encode into.
+            @param in1              The right audio buffer to encode into.
+            @param numSamples       The number of samples to encode into the buffers.
+            @param replace          When True, samples in the buffer will be replaced, when False encoded samples will be mixed with the existing buffer data.
+        */
+        void processBlock(float* in0, float* in1, int numSamples, bool replace = true)
+        {
+            // The bank ramps over each render, so short renders keep the ramp to a fixed length
+            for (int start = 0; start < numSamples; start += LS_ENCODER_UPDATE_INTERVAL)
+            {
+                const int count = numSamples - start < LS_ENCODER_UPDATE_INTERVAL ? numSamples - start : LS_ENCODER_UPDATE_INTERVAL;
+                bank.render(in0 + start, in1 + start, count, replace);
+            }
+        }
+
+    private:
+        OscillatorBank bank;                // the AudioStrobe tone
+        int tone;                           // the index of the tone in the bank
+        const float maxGain;
+    };
+
 } // namespace Lumasonic::Utils
 
 